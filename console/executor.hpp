@@ -73,6 +73,7 @@ private:
     void dump_hardware() const;
     void dump_options() const;
     void dump_body_sizes() const;
+    void dump_allocations() const;
     void dump_records() const;
     void dump_buckets() const;
     void dump_progress() const;
@@ -100,6 +100,43 @@ void executor::dump_body_sizes() const
         query_.address_body_size());
 }
 
+void executor::dump_allocations() const
+{
+    using namespace system;
+
+    if (!node_)
+        return;
+
+    const auto& telemetry = node_->get_telemetry();
+    logger(format(BN_MEASURE_ALLOCATIONS) %
+        telemetry.blocks() %
+        telemetry.overflows() %
+        telemetry.wire_bytes() %
+        telemetry.consumed_bytes() %
+        telemetry.allocated_bytes() %
+        telemetry.multiple(99.0));
+
+    const auto& recycling = node_->get_recycling();
+    logger(format(BN_MEASURE_RECYCLING) %
+        recycling.hits() %
+        recycling.misses() %
+        recycling.retained());
+
+    // Empty buckets are omitted, the last bucket includes all larger values.
+    const auto dump = [&](const auto& histogram)
+    {
+        for (auto index = zero; index < histogram.size(); ++index)
+            if (is_nonzero(histogram.at(index)))
+                logger(format(BN_MEASURE_ALLOCATIONS_ROW) % index %
+                    histogram.at(index));
+    };
+
+    logger(BN_MEASURE_ALLOCATIONS_RATIOS);
+    dump(telemetry.consumed_ratios());
+    logger(BN_MEASURE_ALLOCATIONS_CHUNKS);
+    dump(telemetry.chunk_counts());
+}
+
 void executor::dump_records() const
 {
     logger(format(BN_MEASURE_RECORDS) %
@@ -54,7 +54,16 @@ const std::unordered_map<uint8_t, std::string> executor::fired_
     { events::ancestry_msecs,      "ancestry_msecs......" },
     { events::filter_msecs,        "filter_msecs........" },
     { events::filterhashes_msecs,  "filterhashes_msecs.." },
-    { events::filterchecks_msecs,  "filterchecks_msecs.." }
+    { events::filterchecks_msecs,  "filterchecks_msecs.." },
+
+    { events::backlog_cpu_bound,   "backlog_cpu_bound..." },
+    { events::backlog_store_bound, "backlog_store_bound." },
+    { events::backlog_memory_bound, "backlog_memory_bound" },
+
+    { events::tree_cached,         "tree_cached........." },
+    { events::tree_bytes,          "tree_bytes.........." },
+    { events::tree_evicted,        "tree_evicted........" },
+    { events::tree_purged,         "tree_purged........." }
 };
 
 // Events.
@@ -178,6 +178,7 @@ void executor::do_resume()
 void executor::do_info() const
 {
     dump_body_sizes();
+    dump_allocations();
     dump_records();
     dump_buckets();
     dump_collisions();
@@ -211,6 +212,12 @@ void executor::do_report_work()
 
     logger(format(BN_NODE_REPORT_WORK) % sequence_);
     node_->notify(error::success, chase::report, sequence_++);
+    node_->get_rates([this](const code& ec, const chaser_check::rates& rates)
+    {
+        if (!ec)
+            logger(format(BN_NODE_REPORT_RATES) % rates.count %
+                rates.mean % rates.deviation % rates.p10);
+    });
 }
 
 // [z]eroize
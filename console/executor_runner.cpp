@@ -160,6 +160,7 @@ bool executor::do_run()
 
     // Sizes and records change, buckets don't.
     dump_body_sizes();
+    dump_allocations();
     dump_records();
     ////logger(BN_MEASURE_PROGRESS_START);
     ////dump_progress();
@@ -31,6 +31,63 @@ using namespace network;
 using namespace system;
 
 // arbitrary testing (const).
+// Benchmark transaction hashing of the most recent confirmed blocks of at
+// least protocol_block_in_31800::minimum_parallel_hashing transactions, in
+// sequence and by hash_transactions (std::execution::par when available).
+// Each pass hashes its own read of the block, so neither hits a cached hash.
+void executor::read_test(bool) const
+{
+    constexpr auto blocks = 1'000_size;
+    constexpr auto minimum = protocol_block_in_31800::minimum_parallel_hashing;
+    logger(BN_OPERATION_INTERRUPT);
+
+    size_t count{};
+    size_t txs{};
+    microseconds sequential{};
+    microseconds parallel{};
+    for (auto height = query_.get_top_confirmed(); !cancel_ &&
+        !is_zero(height) && count < blocks; --height)
+    {
+        const auto link = query_.to_confirmed(height);
+        const auto first = query_.get_block(link, true);
+        const auto second = query_.get_block(link, true);
+        if (!first || !second)
+        {
+            logger(format("get_block [%1%] fault.") % height);
+            return;
+        }
+
+        if (first->transactions() < minimum)
+            continue;
+
+        const auto witness = first->is_segregated();
+        auto start = fine_clock::now();
+        for (const auto& tx: *first->transactions_ptr())
+        {
+            tx->set_nominal_hash(tx->hash(false));
+            if (witness && tx->is_segregated())
+                tx->set_witness_hash(tx->hash(true));
+        }
+
+        sequential += duration_cast<microseconds>(fine_clock::now() - start);
+        start = fine_clock::now();
+        protocol_block_in_31800::hash_transactions(*second);
+        parallel += duration_cast<microseconds>(fine_clock::now() - start);
+
+        txs += first->transactions();
+        ++count;
+    }
+
+    if (cancel_)
+        logger(BN_OPERATION_CANCELED);
+
+    logger(format("Hashed [%1%] txs of [%2%] blocks in sequence [%3%] us and "
+        "by hash_transactions [%4%] us.") % txs % count % sequential.count() %
+        parallel.count());
+}
+
+#if defined(UNDEFINED)
+
 void executor::read_test(bool) const
 {
     logger(format("Point table body searches: %1% / (%2% + %1%)") %
@@ -38,8 +95,6 @@ void executor::read_test(bool) const
         store_.point.negative_search_count());
 }
 
-#if defined(UNDEFINED)
-
 void executor::read_test(bool dump) const
 {
     using namespace database;
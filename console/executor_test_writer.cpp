@@ -19,20 +19,195 @@
 #include "executor.hpp"
 #include "localize.hpp"
 
-////#include <boost/format.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <ranges>
+#include <system_error>
+#include <boost/format.hpp>
 #include <bitcoin/node.hpp>
 
 namespace libbitcoin {
 namespace node {
 
-////using boost::format;
+using boost::format;
 using namespace network;
 using namespace system;
 
 // arbitrary testing (non-const).
+// Benchmark confirmability (blocks/sec) of the validated but unconfirmed
+// candidate backlog, in sequence and in windows by chaser_confirm::confirm_run
+// (as by chaser_confirm::confirm_window). Blocks are set strong as confirmed
+// but not set confirmable or pushed, and strong is reverted after each pass.
+// This writes, so it runs against a copy of the (closed) store, which is then
+// removed. An interruption or fault leaves the store itself untouched.
 void executor::write_test(bool)
 {
-    logger("No write test implemented.");
+    using namespace database;
+    constexpr auto blocks = 10'000_size;
+    constexpr auto default_window = 16_size;
+    const auto configured = metadata_.configured.node.confirm_window;
+    const auto window = is_zero(configured) ? default_window : configured;
+
+    // Store settings are held by reference, so must outlive the copy store.
+    auto settings = metadata_.configured.database;
+    settings.path += "_write_test";
+    if (!close_store())
+        return;
+
+    std::error_code fault{};
+    std::filesystem::remove_all(settings.path, fault);
+    if (!fault)
+        std::filesystem::copy(metadata_.configured.database.path,
+            settings.path, std::filesystem::copy_options::recursive, fault);
+
+    if (fault)
+    {
+        logger(format("Store copy fault (%1%).") % fault.message());
+        std::filesystem::remove_all(settings.path, fault);
+        open_store();
+        return;
+    }
+
+    full_node::store store{ settings };
+    full_node::query query{ store };
+    if (const auto ec = store.open([](auto, auto) {}))
+    {
+        logger(format("Store copy open fault (%1%).") % ec.message());
+        std::filesystem::remove_all(settings.path, fault);
+        open_store();
+        return;
+    }
+
+    const auto fork = query.get_top_confirmed();
+    const auto top = query.get_top_candidate();
+    header_links links{};
+    for (auto height = add1(fork); height <= top && links.size() < blocks;
+        ++height)
+    {
+        const auto link = query.to_candidate(height);
+        if (query.get_block_state(link) != database::error::block_valid)
+            break;
+
+        links.push_back(link);
+    }
+
+    logger(BN_OPERATION_INTERRUPT);
+    logger(format("Confirming [%1%] validated blocks above [%2%] by window "
+        "[%3%] in [%4%].") % links.size() % fork % window % settings.path);
+
+    const auto rate = [](size_t count, const auto& span) NOEXCEPT
+    {
+        const auto ms = std::max<int64_t>(span.count(), 1);
+        return (count * 1'000_size) / possible_narrow_sign_cast<size_t>(ms);
+    };
+
+    // Sets strong and tests confirmability of the next block in sequence.
+    header_links strong{};
+    const auto sequential = [&](const header_link& link) NOEXCEPT
+    {
+        if (!query.set_strong(link))
+            return false;
+
+        // As chaser_confirm::confirm_block, unconfirmable is set unstrong.
+        if (query.block_confirmable(link))
+        {
+            if (!query.set_unstrong(link))
+                logger("Sequential set_unstrong fault.");
+
+            return false;
+        }
+
+        strong.push_back(link);
+        return true;
+    };
+
+    // Restores the strong state of the backlog, false if store fault.
+    // Both passes start from the same state, the copy is discarded anyway.
+    const auto revert = [&]() NOEXCEPT
+    {
+        for (const auto& link: std::views::reverse(strong))
+            if (!query.set_unstrong(link))
+                return false;
+
+        strong.clear();
+        return true;
+    };
+
+    // Sequential pass, then windowed pass, reverting strong between them.
+    const auto benchmark = [&]() NOEXCEPT
+    {
+        auto start = fine_clock::now();
+        for (auto link = links.begin(); !cancel_ && link != links.end() &&
+            sequential(*link); ++link);
+
+        auto span = duration_cast<milliseconds>(fine_clock::now() - start);
+        const auto in_sequence = strong.size();
+        logger(format("Sequential: [%1%] confirmable at [%2%] blocks/sec in "
+            "[%3%] ms.") % in_sequence % rate(in_sequence, span) %
+            span.count());
+
+        if (!revert())
+        {
+            logger("Sequential revert fault.");
+            return;
+        }
+
+        // As confirm_window, run not confirmable in window confirms in order.
+        start = fine_clock::now();
+        for (auto first = links.begin(); !cancel_ && first != links.end();)
+        {
+            const auto size = std::min<size_t>(window,
+                std::distance(first, links.end()));
+            header_links run{ first, std::next(first, size) };
+
+            size_t count{};
+            if (const auto ec = chaser_confirm::confirm_run(count, query, run))
+            {
+                logger(format("Window confirm_run fault (%1%).") %
+                    ec.message());
+                return;
+            }
+
+            strong.insert(strong.end(), run.begin(), std::next(run.begin(),
+                count));
+
+            if (is_nonzero(count))
+            {
+                first = std::next(first, count);
+                continue;
+            }
+
+            const auto last = std::next(first, size);
+            for (; first != last && sequential(*first); ++first);
+            if (first != last)
+                break;
+        }
+
+        span = duration_cast<milliseconds>(fine_clock::now() - start);
+        const auto in_window = strong.size();
+        logger(format("Windowed: [%1%] confirmable at [%2%] blocks/sec in "
+            "[%3%] ms.") % in_window % rate(in_window, span) % span.count());
+
+        if (cancel_)
+        {
+            logger(BN_OPERATION_CANCELED);
+            return;
+        }
+
+        if (in_window != in_sequence)
+            logger(format("Windowed confirmable mismatch [%1%] of [%2%].") %
+                in_window % in_sequence);
+    };
+
+    benchmark();
+    if (const auto ec = store.close([](auto, auto) {}))
+        logger(format("Store copy close fault (%1%).") % ec.message());
+
+    std::filesystem::remove_all(settings.path, fault);
+    if (fault)
+        logger(format("Store copy remove fault (%1%).") % fault.message());
+
+    open_store();
 }
 
 #if defined(UNDEFINED)
@@ -101,6 +101,25 @@ namespace node {
     "   strong_tx :%9%\n" \
     "   filter_bk :%10%\n" \
     "   address   :%11%"
+#define BN_MEASURE_ALLOCATIONS \
+    "Block allocations...\n" \
+    "   blocks    :%1%\n" \
+    "   overflows :%2%\n" \
+    "   wire      :%3%\n" \
+    "   consumed  :%4%\n" \
+    "   allocated :%5%\n" \
+    "   multiple  :%6% (99%%)"
+#define BN_MEASURE_RECYCLING \
+    "Chunk recycling...\n" \
+    "   hits      :%1%\n" \
+    "   misses    :%2%\n" \
+    "   retained  :%3%"
+#define BN_MEASURE_ALLOCATIONS_RATIOS \
+    "Allocation ratios (consumed/wire)..."
+#define BN_MEASURE_ALLOCATIONS_CHUNKS \
+    "Allocation chunks (per block)..."
+#define BN_MEASURE_ALLOCATIONS_ROW \
+    "   %1$-10d:%2%"
 #define BN_MEASURE_SLABS \
     "Table slabs..."
 #define BN_MEASURE_SLABS_ROW \
@@ -206,6 +225,8 @@ namespace node {
 
 #define BN_NODE_REPORT_WORK \
     "Requested channel work report [%1%]."
+#define BN_NODE_REPORT_RATES \
+    "Channel rates (%1%) mean (%2%) sdev (%3%) p10 (%4%) bytes per second."
 
 #define BN_NODE_STARTED \
     "Node is started."
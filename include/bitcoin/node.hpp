@@ -16,8 +16,11 @@
 
 #include <bitcoin/database.hpp>
 #include <bitcoin/network.hpp>
+#include <bitcoin/node/association_bitmap.hpp>
 #include <bitcoin/node/block_arena.hpp>
 #include <bitcoin/node/block_memory.hpp>
+#include <bitcoin/node/block_pool.hpp>
+#include <bitcoin/node/block_telemetry.hpp>
 #include <bitcoin/node/chase.hpp>
 #include <bitcoin/node/configuration.hpp>
 #include <bitcoin/node/define.hpp>
@@ -25,7 +28,12 @@
 #include <bitcoin/node/events.hpp>
 #include <bitcoin/node/full_node.hpp>
 #include <bitcoin/node/parser.hpp>
+#include <bitcoin/node/range_connector.hpp>
+#include <bitcoin/node/rate_population.hpp>
+#include <bitcoin/node/rate_statistics.hpp>
 #include <bitcoin/node/settings.hpp>
+#include <bitcoin/node/slow_policy.hpp>
+#include <bitcoin/node/validation_backlog.hpp>
 #include <bitcoin/node/version.hpp>
 #include <bitcoin/node/channels/channel.hpp>
 #include <bitcoin/node/channels/channel_http.hpp>
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_ASSOCIATION_BITMAP_HPP
+#define LIBBITCOIN_NODE_ASSOCIATION_BITMAP_HPP
+
+#include <functional>
+#include <vector>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread UNSAFE dense bitmap of candidate block associations by height.
+/// Heights at or below base are associated, heights above top are unknown
+/// (unset). Heights are loaded from the store on demand by predicate.
+class BCN_API association_bitmap
+{
+public:
+    typedef std::function<bool(size_t height)> predicate;
+
+    /// Heights at or below base are associated, none are loaded.
+    void clear(size_t base) NOEXCEPT;
+
+    /// Heights at or below base are associated.
+    size_t base() const NOEXCEPT;
+
+    /// Heights above top are not loaded.
+    size_t top() const NOEXCEPT;
+
+    /// Set a loaded height associated (heights above top are ignored).
+    void set(size_t height) NOEXCEPT;
+
+    /// Unload heights above the branch point.
+    void reset(size_t branch_point) NOEXCEPT;
+
+    /// Load heights above top through given top by predicate (once each).
+    void load(size_t top, const predicate& associated) NOEXCEPT;
+
+    /// First height at or above height that is not loaded as associated.
+    size_t to_unassociated(size_t height) const NOEXCEPT;
+
+    /// Count of loaded unassociated heights in (above, above + limit].
+    size_t count_unassociated(size_t above, size_t limit) const NOEXCEPT;
+
+    /// First unassociated height above position. Heights are loaded one
+    /// window above the run of associated heights at a time, until an
+    /// unassociated height is loaded or the candidate top is passed.
+    size_t advance(size_t position, size_t window, size_t candidate,
+        const predicate& associated) NOEXCEPT;
+
+private:
+    typedef std::vector<uint64_t> bits;
+
+    // Bit (height - add1(base_)) is set if the candidate is associated.
+    size_t base_{};
+    size_t top_{};
+    bits bits_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
@@ -19,19 +19,29 @@
 #ifndef LIBBITCOIN_NODE_BLOCK_ARENA_HPP
 #define LIBBITCOIN_NODE_BLOCK_ARENA_HPP
 
+#include <bitcoin/node/block_pool.hpp>
+#include <bitcoin/node/block_telemetry.hpp>
 #include <bitcoin/node/define.hpp>
 
 namespace libbitcoin {
 namespace node {
 
 /// Thread UNSAFE detachable linked-linear memory arena.
+/// Release is thread safe when chunks are recycled through a block_pool.
+/// Chunks may be memory mapped (huge page, allocating thread numa node).
 class BCN_API block_arena
   : public arena
 {
 public:
     DELETE_COPY(block_arena);
     
-    block_arena(size_t multiple) NOEXCEPT;
+    /// Chunks are recycled through the pool if specified.
+    /// Chunks are memory mapped as opposed to malloc'd if mapped is set.
+    /// Block allocations are recorded to telemetry if specified.
+    /// First chunk size adapts to observed allocations if adaptive is set,
+    /// in which case multiple is the initial multiple.
+    block_arena(size_t multiple, block_pool* pool=nullptr, bool mapped=false,
+        block_telemetry* telemetry=nullptr, bool adaptive=false) NOEXCEPT;
     block_arena(block_arena&& other) NOEXCEPT;
     virtual ~block_arena() NOEXCEPT;
 
@@ -41,6 +51,7 @@ public:
     NODISCARD void* start(size_t wire_size) THROWS override;
 
     /// Finalize allocation and reset allocator, return total allocation.
+    /// Records the allocation to telemetry and adaptation if specified.
     size_t detach() NOEXCEPT override;
 
     /// Release all chunks chained to the address.
@@ -74,6 +85,58 @@ protected:
         BC_POP_WARNING()
     }
 
+    /// Map throws if memory is not mapped (returns nullptr if unmapped).
+    virtual void* map_(size_t bytes) THROWS;
+
+    /// Unmap does not throw, behavior is undefined if address is incorrect.
+    virtual void unmap_(void* address, size_t bytes) NOEXCEPT;
+
+    /// Obtain chunk from pool (size may be increased to class) or allocate.
+    uint8_t* get_chunk(size_t& size) THROWS;
+
+    /// Return chunk to pool or free it.
+    void put_chunk(uint8_t* chunk) NOEXCEPT;
+
+    /// Free or unmap a prefixed chunk (base address).
+    void free_chunk(uint8_t* base) NOEXCEPT;
+
+    /// Chunks are prefixed by their size when pooled or mapped.
+    INLINE bool is_prefixed() const NOEXCEPT
+    {
+        return !is_null(pool_) || mapped_;
+    }
+
+    /// Get the size prefix of a chunk (base address).
+    INLINE size_t get_prefix(uint8_t* base) const NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+        return reinterpret_cast<const size_t&>(*base);
+        BC_POP_WARNING()
+    }
+
+    /// Set the size prefix of a chunk (base address).
+    INLINE void set_prefix(uint8_t* base, size_t size) const NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+        reinterpret_cast<size_t&>(*base) = size;
+        BC_POP_WARNING()
+    }
+
+    /// Mapped length of a prefixed chunk, huge page multiple when possible.
+    static constexpr size_t to_mapped(size_t size) NOEXCEPT
+    {
+        using namespace system;
+        const auto bytes = size + chunk_prefix;
+        const auto page = bytes < huge_page ? small_page : huge_page;
+        return (bytes + sub1(page)) & ~sub1(page);
+    }
+
+    /// First chunk size for the wire size (fixed or adaptive multiple).
+    size_t to_first(size_t wire_size) const THROWS;
+
+    /// Update the moving average and deviation of consumed/wire size.
+    void adapt(size_t consumed) NOEXCEPT;
+
     /// Link a memory chunk to the allocated stack.
     void push(size_t minimum=zero) THROWS;
 
@@ -108,12 +171,32 @@ protected:
     void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override;
     bool do_is_equal(const arena& other) const NOEXCEPT override;
 
+    /// Prefixed chunks store their size class (preserves alignment).
+    static constexpr size_t chunk_prefix = alignof(std::max_align_t);
+
+    /// Mapped chunks are rounded to these page sizes.
+    static constexpr size_t small_page = 4 * 1024;
+    static constexpr size_t huge_page = 2 * 1024 * 1024;
+
+    // These are thread safe.
+    block_pool* pool_;
+    block_telemetry* telemetry_;
+    bool mapped_;
+    bool adaptive_;
+
     // These are unprotected, caller must guard.
     uint8_t* memory_map_;
     size_t multiple_;
     size_t offset_;
     size_t total_;
     size_t size_;
+
+    // These are unprotected, caller must guard (telemetry and adaptation).
+    size_t wire_;
+    size_t chunks_;
+    size_t allocated_;
+    double mean_;
+    double deviation_;
 };
 
 } // namespace node
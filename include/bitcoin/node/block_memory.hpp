@@ -20,7 +20,10 @@
 #define LIBBITCOIN_NODE_BLOCK_MEMORY_HPP
 
 #include <atomic>
+#include <deque>
 #include <bitcoin/node/block_arena.hpp>
+#include <bitcoin/node/block_pool.hpp>
+#include <bitcoin/node/block_telemetry.hpp>
 #include <bitcoin/node/define.hpp>
 
 namespace libbitcoin {
@@ -37,12 +40,31 @@ public:
     /// Returns default_arena if multiple is zero or threads exceeded.
     block_memory(size_t multiple, size_t threads) NOEXCEPT;
 
+    /// Per thread retention of up to retain bytes of recycled chunks.
+    /// Chunks are not recycled if retain is zero.
+    /// Chunks are memory mapped (huge page, numa local) if mapped is set.
+    /// First chunks adapt to observed allocations if adaptive is set.
+    block_memory(size_t multiple, size_t threads, size_t retain, bool mapped,
+        bool adaptive) NOEXCEPT;
+
     /// Each thread obtains an arena.
     arena* get_arena() NOEXCEPT override;
 
+    /// Chunk recycling statistics summed over all arenas.
+    size_t hits() const NOEXCEPT;
+    size_t misses() const NOEXCEPT;
+    size_t retained() const NOEXCEPT;
+
+    /// Block allocation histograms aggregated over all arenas.
+    const block_telemetry& telemetry() const NOEXCEPT;
+
 protected:
     // This is thread safe.
     std::atomic_size_t count_{ zero };
+    block_telemetry telemetry_{};
+
+    // These are protected by constructor init (pools must outlive arenas).
+    std::deque<block_pool> pools_{};
 
     // This is protected by constructor init and thread_local indexation.
     std::vector<block_arena> arenas_{};
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_BLOCK_POOL_HPP
+#define LIBBITCOIN_NODE_BLOCK_POOL_HPP
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread SAFE size-classed free list of recycled block_arena chunks.
+/// Chunks are retained by the arena owning thread's pool upon release (from
+/// any thread) and reissued by the owning arena, up to the retention limit.
+/// Counters are maintained atomically and obtained by query, not reported.
+class BCN_API block_pool
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(block_pool);
+
+    /// Smallest chunk size class.
+    static constexpr size_t minimum_class = 4096;
+
+    /// Round chunk size up to its size class (four classes per power of two).
+    static constexpr size_t to_class(size_t bytes) NOEXCEPT
+    {
+        using namespace system;
+        if (bytes <= minimum_class)
+            return minimum_class;
+
+        // Internal fragmentation is bounded to 25% of the requested size.
+        const auto step = power2(floored_log2(bytes) - two);
+        if (is_add_overflow(bytes, sub1(step)))
+            return bytes;
+
+        return (bytes + sub1(step)) & ~sub1(step);
+    }
+
+    /// Retain up to limit bytes of chunks.
+    block_pool(size_t limit) NOEXCEPT;
+
+    /// Pop a retained chunk of the size class, nullptr if none.
+    uint8_t* get(size_t size) NOEXCEPT;
+
+    /// Retain chunk of the size class, false if limit would be exceeded.
+    bool put(uint8_t* chunk, size_t size) NOEXCEPT;
+
+    /// Remove all retained chunks, caller assumes ownership.
+    std::vector<uint8_t*> clear() NOEXCEPT;
+
+    /// Number of chunk requests satisfied from retained chunks.
+    size_t hits() const NOEXCEPT;
+
+    /// Number of chunk requests not satisfied from retained chunks.
+    size_t misses() const NOEXCEPT;
+
+    /// Number of bytes currently retained.
+    size_t retained() const NOEXCEPT;
+
+protected:
+    typedef std::unordered_map<size_t, std::vector<uint8_t*>> chunks;
+
+    // These are thread safe.
+    const size_t limit_;
+    std::atomic_size_t hits_{};
+    std::atomic_size_t misses_{};
+    std::atomic_size_t retained_{};
+
+    // These are protected by mutex.
+    std::mutex mutex_{};
+    chunks chunks_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_BLOCK_TELEMETRY_HPP
+#define LIBBITCOIN_NODE_BLOCK_TELEMETRY_HPP
+
+#include <array>
+#include <atomic>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread SAFE block_arena occupancy and fragmentation histograms.
+/// Recorded once per block (detach), used to tune allocation_multiple.
+class BCN_API block_telemetry
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(block_telemetry);
+
+    /// Histogram buckets, the last bucket accumulates all larger values.
+    static constexpr size_t ratio_buckets = 64;
+    static constexpr size_t chunk_buckets = 16;
+
+    typedef std::array<size_t, ratio_buckets> ratios;
+    typedef std::array<size_t, chunk_buckets> chunks;
+
+    block_telemetry() NOEXCEPT;
+
+    /// Record a block's wire size, arena bytes consumed (including links),
+    /// arena bytes allocated (capacity), and number of chunks allocated.
+    void record(size_t wire, size_t consumed, size_t allocated,
+        size_t chunks) NOEXCEPT;
+
+    /// Number of blocks recorded.
+    size_t blocks() const NOEXCEPT;
+
+    /// Number of blocks that required more than one chunk (push overflow).
+    size_t overflows() const NOEXCEPT;
+
+    /// Byte totals over all recorded blocks.
+    size_t wire_bytes() const NOEXCEPT;
+    size_t consumed_bytes() const NOEXCEPT;
+    size_t allocated_bytes() const NOEXCEPT;
+
+    /// Histogram of consumed/wire size (ceilinged), indexed by ratio.
+    ratios consumed_ratios() const NOEXCEPT;
+
+    /// Histogram of chunks per block, indexed by chunk count.
+    chunks chunk_counts() const NOEXCEPT;
+
+    /// Smallest allocation multiple that would fit the given percentage of
+    /// recorded blocks within a single chunk (zero if no blocks recorded).
+    size_t multiple(double percent) const NOEXCEPT;
+
+protected:
+    template <size_t Size>
+    using counters = std::array<std::atomic_size_t, Size>;
+
+    // These are thread safe.
+    std::atomic_size_t blocks_;
+    std::atomic_size_t overflows_;
+    std::atomic_size_t wire_;
+    std::atomic_size_t consumed_;
+    std::atomic_size_t allocated_;
+    counters<ratio_buckets> ratios_;
+    counters<chunk_buckets> chunks_;
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
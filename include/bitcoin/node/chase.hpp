@@ -69,6 +69,14 @@ enum class chase
     /// Issued by 'check' and handled by 'block_in_31800'.
     purge,
 
+    /// Channel directed to drop a redundantly requested block (height_t).
+    /// Issued by 'check' and handled by 'block_in_31800'.
+    cancel,
+
+    /// Channel holds a block also requested from another channel (height_t).
+    /// Issued by 'check' and handled by 'block_in_31800'.
+    shared,
+
     /// Channels (all) directed to write work count to the log (count_t).
     /// Issued by 'executor' and handled by 'block_in_31800'.
     report,
@@ -141,6 +149,11 @@ enum class chase
     /// Issued by 'confirm' [and handled by 'transaction'].
     organized,
 
+    /// Confirmable blocks have been confirmed through height (height_t).
+    /// Issued by 'confirm' when not current, in place of per block
+    /// 'confirmable' and 'organized' [and handled by 'transaction'].
+    confirmed,
+
     /// A previously confirmed block has been unconfirmed (header_t).
     /// Issued by 'confirm' [and handled by 'transaction'].
     reorganized,
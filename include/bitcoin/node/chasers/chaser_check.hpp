@@ -20,9 +20,12 @@
 #define LIBBITCOIN_NODE_CHASERS_CHASER_CHECK_HPP
 
 #include <deque>
-#include <unordered_map>
+#include <map>
+#include <bitcoin/node/association_bitmap.hpp>
 #include <bitcoin/node/chasers/chaser.hpp>
 #include <bitcoin/node/define.hpp>
+#include <bitcoin/node/rate_population.hpp>
+#include <bitcoin/node/slow_policy.hpp>
 
 namespace libbitcoin {
 namespace node {
@@ -36,6 +39,17 @@ class BCN_API chaser_check
 public:
     DELETE_COPY_MOVE_DESTRUCT(chaser_check);
 
+    /// Snapshot of reporting channel download rates (bytes per second).
+    struct rates
+    {
+        size_t count;
+        double mean;
+        double deviation;
+        double p10;
+    };
+
+    typedef std::function<void(const code&, const rates&)> rates_handler;
+
     /// Create empty shared map.
     static map_ptr empty_map() NOEXCEPT;
 
@@ -49,13 +63,19 @@ public:
     void stopping(const code& ec) NOEXCEPT override;
 
     /// Interface for protocols to provide performance data.
-    virtual void update(object_key channel, uint64_t speed,
+    virtual void update(object_key channel, uint64_t speed, uint64_t latency,
         network::result_handler&& handler) NOEXCEPT;
 
+    /// Interface for monitoring channel performance.
+    virtual void get_rates(rates_handler&& handler) NOEXCEPT;
+
     /// Interface for protocols to obtain/return pending download identifiers.
     /// Identifiers not downloaded must be returned or chain will remain gapped.
-    virtual void get_hashes(map_handler&& handler) NOEXCEPT;
-    virtual void put_hashes(const map_ptr& map,
+    /// Obtained identifiers are sized in proportion to channel performance.
+    /// Redundant (endgame) identifiers are obtained only by idle channels.
+    virtual void get_hashes(object_key channel, bool idle,
+        map_handler&& handler) NOEXCEPT;
+    virtual void put_hashes(object_key channel, const map_ptr& map,
         network::result_handler&& handler) NOEXCEPT;
 
 protected:
@@ -70,21 +90,42 @@ protected:
     virtual void do_headers(height_t branch_point) NOEXCEPT;
     virtual void do_regressed(height_t branch_point) NOEXCEPT;
     virtual void do_handle_purged(const code& ec) NOEXCEPT;
-    virtual void do_get_hashes(const map_handler& handler) NOEXCEPT;
-    virtual void do_put_hashes(const map_ptr& map,
+    virtual void do_get_hashes(object_key channel, bool idle,
+        const map_handler& handler) NOEXCEPT;
+    virtual void do_put_hashes(object_key channel, const map_ptr& map,
         const network::result_handler& handler) NOEXCEPT;
 
     /// channel performance
     virtual void do_starved(object_t self) NOEXCEPT;
     virtual void do_update(object_key channel, uint64_t speed,
-        const network::result_handler& handler) NOEXCEPT;
+        uint64_t latency, const network::result_handler& handler) NOEXCEPT;
+    virtual void do_get_rates(const rates_handler& handler) NOEXCEPT;
 
 private:
     static constexpr size_t minimum_for_standard_deviation = 3;
-    typedef std::unordered_map<object_key, double> speeds;
     typedef std::deque<map_ptr> maps;
 
-    map_ptr get_map() NOEXCEPT;
+    // Issued associations by height, with holding and redundant channels.
+    struct issue
+    {
+        object_key owner;
+        object_key copy;
+        database::association item;
+    };
+    typedef std::map<size_t, issue> issues;
+
+    // Outstanding work tracking for endgame redundant requests.
+    void set_issued(object_key channel, const map_ptr& map) NOEXCEPT;
+    void set_returned(object_key channel, const map_ptr& map) NOEXCEPT;
+    void set_downloaded(size_t height) NOEXCEPT;
+    map_ptr get_endgame(object_key channel, size_t size) NOEXCEPT;
+
+    // Advance position over associated candidates, return first unassociated.
+    size_t advance_associated() NOEXCEPT;
+    bool is_associated(size_t height) const NOEXCEPT;
+
+    map_ptr get_map(object_key channel, bool idle) NOEXCEPT;
+    size_t get_map_size(object_key channel) const NOEXCEPT;
     size_t set_unassociated() NOEXCEPT;
     size_t get_inventory_size() const NOEXCEPT;
     bool set_map(const map_ptr& map) NOEXCEPT;
@@ -97,7 +138,8 @@ private:
     const size_t maximum_concurrency_;
     const size_t maximum_height_;
     const size_t connections_;
-    const float allowed_deviation_;
+    const slow_policy::ptr policy_;
+    const size_t endgame_blocks_;
 
     // These are protected by strand.
     size_t inventory_{};
@@ -105,9 +147,15 @@ private:
     size_t advanced_{};
     job::ptr job_{};
 
-    // TODO: optimize, default bucket count is around 8.
-    speeds speeds_{};
+    rate_population population_{};
     maps maps_{};
+
+    // Candidates at or below base are associated, above top are unknown.
+    association_bitmap associated_{};
+
+    // Redundantly requested (endgame) heights are counted by redundant_.
+    size_t redundant_{};
+    issues issued_{};
 };
 
 } // namespace node
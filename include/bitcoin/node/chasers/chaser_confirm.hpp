@@ -19,6 +19,8 @@
 #ifndef LIBBITCOIN_NODE_CHASERS_CHASER_CONFIRM_HPP
 #define LIBBITCOIN_NODE_CHASERS_CHASER_CONFIRM_HPP
 
+#include <set>
+#include <vector>
 #include <bitcoin/node/chasers/chaser.hpp>
 #include <bitcoin/node/define.hpp>
 
@@ -38,6 +40,12 @@ public:
 
     code start() NOEXCEPT override;
 
+    /// Tentatively set strong the leading independent run of valid links
+    /// (truncated to it), obtaining the count of its leading confirmable
+    /// blocks in parallel. Blocks above count are reverted to unstrong.
+    static code confirm_run(size_t& count, query& query,
+        database::header_links& links) NOEXCEPT;
+
 protected:
     using header_link = database::header_link;
     using header_links = database::header_links;
@@ -50,6 +58,7 @@ protected:
     virtual void do_validated(height_t height) NOEXCEPT;
     virtual void do_bumped(height_t height) NOEXCEPT;
     virtual void do_bump(height_t height) NOEXCEPT;
+    virtual void do_resync(height_t height) NOEXCEPT;
 
     virtual void reorganize(header_states& fork, size_t top,
         size_t fork_point) NOEXCEPT;
@@ -57,19 +66,49 @@ protected:
         size_t fork_point) NOEXCEPT;
     virtual bool confirm_block(const header_link& link,
         size_t height, const header_links& popped, size_t fork_point) NOEXCEPT;
+    virtual bool confirm_window(size_t& count, size_t& run,
+        const header_states& fork, size_t start, size_t height) NOEXCEPT;
     virtual bool complete_block(const code& ec, const header_link& link,
         size_t height, bool bypassed) NOEXCEPT;
 
 private:
+    typedef std::vector<code> codes;
+
+    static codes confirmable(const query& query,
+        const database::header_links& links) NOEXCEPT;
+    static size_t independent(const query& query,
+        const database::header_links& links) NOEXCEPT;
+    bool extend_fork(height_t height) NOEXCEPT;
+    void resync_fork() NOEXCEPT;
+    bool get_work(uint256_t& work, const header_states& fork,
+        size_t fork_point) NOEXCEPT;
     bool set_reorganized(const header_link& link,
         height_t confirmed_height) NOEXCEPT;
     bool set_organized(const header_link& link,
         height_t confirmed_height) NOEXCEPT;
     bool roll_back(const header_links& popped, size_t fork_point,
         size_t top) NOEXCEPT;
+    void organized(const header_link& link, height_t confirmed_height) NOEXCEPT;
+    void flush_organized() NOEXCEPT;
     void announce(const header_link& link, height_t height) NOEXCEPT;
     
-    // This is thread safe.
+    // These are protected by strand.
+    std::set<height_t> pending_{};
+    header_states fork_{};
+    size_t fork_point_{};
+    height_t validated_{};
+    bool resync_{};
+    header_link worked_link_{};
+    size_t worked_point_{};
+    size_t worked_{};
+    uint256_t work_{};
+    bool batching_{};
+    size_t organized_{};
+    height_t organized_top_{};
+
+    // These are thread safe.
+    const size_t confirm_batch_;
+    const size_t confirm_window_;
     const bool filter_;
 };
 
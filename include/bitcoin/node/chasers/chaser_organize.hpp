@@ -19,6 +19,9 @@
 #ifndef LIBBITCOIN_NODE_CHASERS_CHASER_ORGANIZE_HPP
 #define LIBBITCOIN_NODE_CHASERS_CHASER_ORGANIZE_HPP
 
+#include <deque>
+#include <map>
+#include <set>
 #include <unordered_map>
 #include <bitcoin/node/chasers/chaser.hpp>
 #include <bitcoin/node/define.hpp>
@@ -108,6 +111,7 @@ protected:
 private:
     using header_links = database::header_links;
     using header_states = database::header_states;
+    using block_heights = std::multimap<size_t, typename Block::cptr>;
 
     // Template differentiators.
     // ------------------------------------------------------------------------
@@ -163,6 +167,25 @@ private:
     void cache(const typename Block::cptr& block,
         const chain_state::cptr& state) NOEXCEPT;
 
+    // Remove tree entries below height and all of their descendants,
+    // returning the number removed.
+    size_t prune(size_t height) NOEXCEPT;
+
+    // Remove weak leaves (lowest first) until within bytes, never an ancestor
+    // of the strongest tree branch, returning the number removed.
+    size_t evict(uint64_t bytes) NOEXCEPT;
+
+    // Maintain tree children, leaves and strongest entry as tree changes.
+    void index(const Block& block) NOEXCEPT;
+    void unindex(const Block& block) NOEXCEPT;
+
+    // Remove tree entry at given heights_ position (and its accounting).
+    typename block_heights::iterator remove(
+        typename block_heights::iterator it) NOEXCEPT;
+
+    // Remove heights_ entry and accounting for block extracted from tree.
+    void forget(const Block& block) NOEXCEPT;
+
     // Getters.
     // ------------------------------------------------------------------------
 
@@ -170,6 +193,19 @@ private:
     chain_state::cptr get_chain_state(
         const system::hash_digest& previous_hash) const NOEXCEPT;
 
+    // Top checkpoint height at or below given height (zero if none).
+    size_t get_checkpoint(size_t height) const NOEXCEPT;
+
+    // Approximate memory allocated to Block in the tree.
+    static size_t get_allocation(const Block& block) NOEXCEPT;
+
+    // Obtain chain state for given candidate height, nullptr if not found.
+    chain_state::cptr get_candidate_state(size_t height) const NOEXCEPT;
+
+    // Retain new candidate top state, dropping those above branch point.
+    void remember(const chain_state::cptr& state,
+        size_t branch_point) NOEXCEPT;
+
     // Sum of work from header to branch point (excluded).
     bool get_branch_work(uint256_t& branch_work,
         system::hashes& tree_branch, header_states& store_branch,
@@ -182,16 +218,29 @@ private:
     void log_state_change(const chain_state& from,
         const chain_state& to) const NOEXCEPT;
 
+    // Recent candidate states retained to avoid store (full chain) scans.
+    static constexpr size_t maximum_recent = 144;
+
     // These are thread safe.
     const system::settings& settings_;
     const system::chain::checkpoints& checkpoints_;
+    const uint64_t maximum_tree_;
 
     // These are protected by strand.
     bool bumped_{};
     chain_state::cptr state_{};
+    std::deque<chain_state::cptr> recent_{};
 
     // TODO: optimize, default bucket count is around 8.
     block_tree tree_{};
+    block_heights heights_{};
+    uint64_t tree_bytes_{};
+
+    // Tree index, children counted by parent hash and leaves by height.
+    std::unordered_map<system::hash_digest, size_t> children_{};
+    std::set<std::pair<size_t, system::hash_digest>> leaves_{};
+    const Block* strongest_{};
+    size_t checkpoint_{};
 };
 
 } // namespace node
@@ -20,8 +20,14 @@
 #define LIBBITCOIN_NODE_CHASERS_CHASER_VALIDATE_HPP
 
 #include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <bitcoin/node/chasers/chaser.hpp>
 #include <bitcoin/node/define.hpp>
+#include <bitcoin/node/range_connector.hpp>
+#include <bitcoin/node/validation_backlog.hpp>
 
 namespace libbitcoin {
 namespace node {
@@ -44,6 +50,17 @@ public:
 protected:
     typedef network::race_unity<const code&, const database::tx_link&> race;
 
+    /// A block populated for validation (output of the populate stage).
+    struct populated
+    {
+        system::chain::block::cptr block;
+        database::header_link link;
+        system::chain::context ctx;
+        std::chrono::steady_clock::time_point start;
+        size_t bytes;
+        bool bypass;
+    };
+
     virtual bool handle_event(const code& ec, chase event_,
         event_value value) NOEXCEPT;
 
@@ -52,15 +69,21 @@ protected:
     virtual void do_bumped(height_t height) NOEXCEPT;
     virtual void do_bump(height_t height) NOEXCEPT;
 
-    virtual void post_block(const database::header_link& link,
+    virtual void post_block(const database::header_link& link, size_t height,
         bool bypass) NOEXCEPT;
+    virtual void post_prefetch(size_t height) NOEXCEPT;
+    virtual void prefetch_block(const database::header_link& link,
+        size_t height) NOEXCEPT;
     virtual void validate_block(const database::header_link& link,
-        bool bypass) NOEXCEPT;
+        bool bypass, const system::chain::block::cptr& block) NOEXCEPT;
+    virtual void connect_block(code ec, const populated& item) NOEXCEPT;
     virtual code validate(bool bypass, const system::chain::block& block,
         const database::header_link& link,
         const system::chain::context& ctx) NOEXCEPT;
     virtual code populate(bool bypass, const system::chain::block& block,
         const system::chain::context& ctx) NOEXCEPT;
+    virtual code connect(const system::chain::block& block,
+        const system::chain::context& ctx) NOEXCEPT;
     virtual void complete_block(const code& ec,
         const database::header_link& link, size_t height,
         bool bypassed) NOEXCEPT;
@@ -70,15 +93,46 @@ protected:
     bool stranded() const NOEXCEPT override;
 
 private:
+    // A block read ahead of validation, keyed by height in blocks.
+    struct prefetched
+    {
+        database::header_link link;
+        system::chain::block::cptr block;
+    };
+    typedef std::map<size_t, prefetched> blocks;
+
+    static constexpr size_t connect_range = 16;
+    static constexpr size_t minimum_parallel_inputs = 1024;
+    void connect_ranges(const range_connector::ptr& connector) NOEXCEPT;
+    static code connect_limits(const system::chain::block& block,
+        const system::chain::context& ctx) NOEXCEPT;
+    static bool is_parallel(const system::chain::transaction_cptrs& txs,
+        size_t minimum) NOEXCEPT;
+    void report(validation_backlog::bound bound) NOEXCEPT;
+    bool is_throttled() NOEXCEPT;
+    system::chain::block::cptr get_block(
+        const database::header_link& link) const NOEXCEPT;
+
     // This is protected by strand.
     network::threadpool threadpool_;
+    network::threadpool populator_;
+    size_t prefetched_{};
+
+    // These are protected by mutex (by height, null block is a pending read).
+    blocks prefetch_{};
+    std::mutex prefetch_mutex_{};
 
     // These are thread safe.
     std::atomic<size_t> backlog_{};
+    std::atomic_bool throttled_{};
     network::asio::strand independent_strand_;
+    network::asio::strand prefetch_strand_;
     const uint32_t subsidy_interval_;
     const uint64_t initial_subsidy_;
-    const size_t maximum_backlog_;
+    validation_backlog backlog_limit_;
+    const size_t threads_;
+    const size_t prefetch_blocks_;
+    const size_t populate_threads_;
     const bool node_witness_;
     const bool filter_;
 };
@@ -63,6 +63,7 @@ typedef network::race_all<const code&> job;
 typedef std::shared_ptr<database::associations> map_ptr;
 typedef std::function<void(const code&, const map_ptr&,
     const job::ptr&)> map_handler;
+typedef std::function<void()> work_handler;
 
 /// Event desubscriber key type.
 using object_key = uint64_t;
@@ -98,7 +98,9 @@ enum error_t : uint8_t
     confirm10,
     confirm11,
     confirm12,
-    confirm13
+    confirm13,
+    confirm14,
+    confirm15
 };
 
 // No current need for error_code equivalence mapping.
@@ -62,7 +62,18 @@ enum events : uint8_t
     ancestry_msecs,       // getancestry timespan in milliseconds.
     filter_msecs,         // getfilter timespan in milliseconds.
     filterhashes_msecs,   // getfilterhashes timespan in milliseconds.
-    filterchecks_msecs    // getcfcheckpt timespan in milliseconds.
+    filterchecks_msecs,   // getcfcheckpt timespan in milliseconds.
+
+    /// Validation backlog.
+    backlog_cpu_bound,    // backlog held or increased (backlog limit).
+    backlog_store_bound,  // backlog decreased, store contention (backlog limit).
+    backlog_memory_bound, // backlog halved, outstanding bytes (backlog limit).
+
+    /// Header tree.
+    tree_cached,          // header/block cached in tree (tree entries).
+    tree_bytes,           // header/block cached in tree (tree bytes).
+    tree_evicted,         // tree entries evicted at memory bound (count).
+    tree_purged           // tree entries purged at checkpoint (count).
 };
 
 } // namespace node
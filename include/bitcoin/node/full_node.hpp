@@ -19,6 +19,9 @@
 #ifndef LIBBITCOIN_NODE_FULL_NODE_HPP
 #define LIBBITCOIN_NODE_FULL_NODE_HPP
 
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
 #include <bitcoin/node/block_memory.hpp>
 #include <bitcoin/node/chasers/chasers.hpp>
 #include <bitcoin/node/configuration.hpp>
@@ -77,8 +80,9 @@ public:
         organize_handler&& handler) NOEXCEPT;
 
     /// Manage download queue.
-    virtual void get_hashes(map_handler&& handler) NOEXCEPT;
-    virtual void put_hashes(const map_ptr& map,
+    virtual void get_hashes(object_key channel, bool idle,
+        map_handler&& handler) NOEXCEPT;
+    virtual void put_hashes(object_key channel, const map_ptr& map,
         result_handler&& handler) NOEXCEPT;
 
     /// Events.
@@ -147,11 +151,30 @@ public:
 
     /// Handle performance, base returns false (implied terminate).
     virtual void performance(object_key channel, uint64_t speed,
-        result_handler&& handler) NOEXCEPT;
+        uint64_t latency, result_handler&& handler) NOEXCEPT;
+
+    /// Post work to the block check threadpool, false if not configured or
+    /// if in-flight checks (across all channels) are at the thread count.
+    virtual bool post_check(work_handler&& work) NOEXCEPT;
+
+    /// Archive a checked block, claimed so that it is written only once.
+    /// Sets redundant (without write) if archived or claimed by another.
+    virtual code archive_block(bool& redundant,
+        const system::chain::block& block, const database::header_link& link,
+        bool checked) NOEXCEPT;
+
+    /// Get a snapshot of channel download rates.
+    virtual void get_rates(chaser_check::rates_handler&& handler) NOEXCEPT;
 
     /// Get the memory resource.
     virtual network::memory& get_memory() NOEXCEPT;
 
+    /// Get the memory resource block allocation histograms.
+    virtual const block_telemetry& get_telemetry() const NOEXCEPT;
+
+    /// Get the memory resource chunk recycling counters.
+    virtual const block_memory& get_recycling() const NOEXCEPT;
+
 protected:
     /// Session attachments.
     /// -----------------------------------------------------------------------
@@ -194,8 +217,14 @@ private:
     // These are thread safe.
     const configuration& config_;
     memory_controller memory_;
+    network::threadpool checker_;
+    std::atomic_size_t checking_{};
     query& query_;
 
+    // These are protected by mutex.
+    std::unordered_set<header_t> archiving_{};
+    std::mutex archiving_mutex_{};
+
     // These are protected by strand.
     chaser_block chaser_block_;
     chaser_header chaser_header_;
@@ -21,6 +21,8 @@
 
 #include <algorithm>
 #include <ranges>
+#include <unordered_map>
+#include <unordered_set>
 #include <bitcoin/node/chasers/chaser.hpp>
 #include <bitcoin/node/define.hpp>
 
@@ -34,7 +36,8 @@ TEMPLATE
 CLASS::chaser_organize(full_node& node) NOEXCEPT
   : chaser(node),
     settings_(config().bitcoin),
-    checkpoints_(config().bitcoin.checkpoints)
+    checkpoints_(config().bitcoin.checkpoints),
+    maximum_tree_(config().node.tree_bytes)
 {
 }
 
@@ -45,9 +48,11 @@ code CLASS::start() NOEXCEPT
 
     // Initialize cache of top candidate chain state.
     // Spans full chain to obtain cumulative work. This can be optimized by
-    // storing it with each header, though the scan is fast. The same occurs
-    // when a block first branches below the current chain top. Chain work
-    // is a questionable DoS protection scheme only, so could also toss it.
+    // storing it with each header, though the scan is fast. Subsequent states
+    // below the top are obtained from recent_ where possible, as the same scan
+    // otherwise occurs when a block first branches below the current top.
+    // Chain work is a questionable DoS protection scheme only, so could also
+    // toss it.
     const auto& query = archive();
     const auto top = query.get_top_candidate();
     state_ = query.get_candidate_chain_state(settings_, top);
@@ -58,6 +63,9 @@ code CLASS::start() NOEXCEPT
         return error::organize1;
     }
 
+    remember(state_, top);
+    checkpoint_ = get_checkpoint(top);
+
     LOGN("Candidate top [" << system::encode_hash(state_->hash()) << ":"
         << state_->height() << "].");
 
@@ -174,14 +182,18 @@ void CLASS::do_organize(typename Block::cptr block,
         return;
     };
 
-    // TODO: If any checkpoint is reached then reject non-candidates below.
-    // TODO: because checkpoints are storable (and therefore stored) along with
-    // TODO: all ancestor blocks, which therefore much be candidates as well.
-    // TODO: When a checkpoint is pushed and after its branch is reorganized,
-    // TODO: purge all blocks in the tree with height at/below that checkpoint.
-    // TODO: The combination strongly mitigates low pow sybil attacks against
-    // TODO: the header tree, as all are purged as each checkpoint is reached,
-    // TODO: and no more are ever accepted below the top checkpoint.
+    // Once a checkpoint is reached reject non-candidates at/below it, because
+    // checkpoints are storable (and therefore stored) along with all ancestor
+    // blocks, which therefore must be candidates as well. When a checkpoint is
+    // pushed, all blocks in the tree with height at/below it are purged. The
+    // combination strongly mitigates low pow sybil attacks against the header
+    // tree, as all are purged as each checkpoint is reached, and no more are
+    // ever accepted below the top checkpoint. Candidates are duplicates.
+    if (height <= checkpoint_)
+    {
+        handler(system::error::checkpoint_conflict, height);
+        return;
+    }
 
     // Blocks of headers are validated later, malleations ignored until then.
     // Blocks are fully validated (not confirmed), so malleation is non-issue.
@@ -318,8 +330,22 @@ void CLASS::do_organize(typename Block::cptr block,
         notify(error::success, chase_object(), branch_point);
     }
 
+    // Purge tree at/below newly-reached checkpoint (and its descendants).
+    const auto checkpoint = get_checkpoint(height);
+    if (checkpoint > checkpoint_)
+    {
+        checkpoint_ = checkpoint;
+        if (const auto count = prune(add1(checkpoint)))
+        {
+            fire(events::tree_purged, count);
+            LOGN("Purged [" << count << "] tree entries at checkpoint ["
+                << checkpoint << "].");
+        }
+    }
+
     // Logs from candidate block parent to the candidate (forward sequential).
     log_state_change(*parent, *state);
+    remember(state, branch_point);
     state_ = state;
     handler(error::success, height);
 }
@@ -353,13 +379,16 @@ void CLASS::do_disorganize(header_t link) NOEXCEPT
     // Copy valid portion of branch (below link) into header tree with state.
     // ........................................................................
 
-    auto state = query.get_candidate_chain_state(settings_, fork_point);
-    if (!state)
+    const auto branch_point = fork_point;
+    const auto fork_state = get_candidate_state(fork_point);
+    if (!fork_state)
     {
         fault(error::organize7);
         return;
     }
 
+    auto state = fork_state;
+
     for (const auto& candidate: candidates)
     {
         typename Block::cptr block{};
@@ -410,6 +439,9 @@ void CLASS::do_disorganize(header_t link) NOEXCEPT
     // Candidate fork link used to ensure consistency with confirmed chain.
     const auto fork = query.to_candidate(fork_point);
 
+    // Top candidate state is rolled forward from fork point through confirmeds.
+    state = fork_state;
+
     // Guarded by confirmed interlock, ensures fork point consistency.
     for (const auto& confirmed: query.get_confirmed_fork(fork))
     {
@@ -418,21 +450,24 @@ void CLASS::do_disorganize(header_t link) NOEXCEPT
             fault(error::organize12);
             return;
         }
+
+        const auto header = query.get_header(confirmed);
+        if (!header)
+        {
+            fault(error::organize13);
+            return;
+        }
+
+        state = to_shared<chain::chain_state>(*state, *header, settings_);
     }
 
     // Reset top candidate state to match confirmed, log and notify.
     // ........................................................................
 
-    // fork_point reflects the new candidate top.
-    state = query.get_candidate_chain_state(settings_, fork_point);
-    if (!state)
-    {
-        fault(error::organize13);
-        return;
-    }
-
     // Logs from previous top candidate to previous fork point (jumps back).
     log_state_change(*state_, *state);
+    remember(state, branch_point);
+    checkpoint_ = get_checkpoint(state->height());
     state_ = state;
 
     // Candidate is same as confirmed, reset chasers to new top.
@@ -523,6 +558,7 @@ code CLASS::push_block(const system::hash_digest& key) NOEXCEPT
         return error::organize15;
 
     const auto& block = handle.mapped();
+    forget(*block);
     return push_block(*block, block->get_state()->context());
 }
 
@@ -533,8 +569,164 @@ void CLASS::cache(const typename Block::cptr& block,
     // Any block obtained from the tree must have state cached.
     block->set_state(state);
 
-    // TODO: guard cache against memory exhaustion (DoS).
     tree_.emplace(system::hash_cref(block->get_hash()), block);
+    heights_.emplace(state->height(), block);
+    tree_bytes_ += get_allocation(*block);
+    index(*block);
+
+    // Guard cache against memory exhaustion (DoS) by evicting weak branches.
+    if (is_nonzero(maximum_tree_) && tree_bytes_ > maximum_tree_)
+    {
+        if (const auto count = evict(maximum_tree_))
+            fire(events::tree_evicted, count);
+    }
+
+    fire(events::tree_cached, tree_.size());
+    fire(events::tree_bytes, tree_bytes_);
+}
+
+TEMPLATE
+size_t CLASS::prune(size_t height) NOEXCEPT
+{
+    // Ascending height ensures each parent is removed before its children.
+    std::unordered_set<system::hash_digest> removed{};
+    auto it = heights_.begin();
+    while (it != heights_.end() && it->first < height)
+    {
+        removed.insert(it->second->get_hash());
+        it = remove(it);
+    }
+
+    // Descendants must be removed, as a tree branch must reach the store.
+    while (!removed.empty() && it != heights_.end())
+    {
+        const auto& previous = get_header(*it->second).previous_block_hash();
+        if (removed.contains(previous))
+        {
+            removed.insert(it->second->get_hash());
+            it = remove(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return removed.size();
+}
+
+TEMPLATE
+size_t CLASS::evict(uint64_t bytes) NOEXCEPT
+{
+    // The strongest tree branch is the pending (e.g. headers-first) candidate
+    // chain, or its strongest competitor. Its top is the strongest entry, a
+    // leaf, and its ancestors are never leaves, so only that leaf is retained.
+    // The strongest is found over leaves only when the previous was removed.
+    if (is_null(strongest_))
+    {
+        for (const auto& leaf: leaves_)
+        {
+            const auto& block = *tree_.at(system::hash_cref(leaf.second));
+            if (is_null(strongest_) ||
+                block.get_state()->cumulative_work() >
+                strongest_->get_state()->cumulative_work())
+                strongest_ = &block;
+        }
+    }
+
+    // Low heights are the least costly to mine and the furthest from the
+    // candidate top, so low leaves are the most likely to be sybil branches.
+    // Removal of a leaf may expose its (lower) parent as a leaf. The tree may
+    // remain above bytes if only the strongest branch remains.
+    size_t count{};
+    auto leaf = leaves_.begin();
+    while (tree_bytes_ > bytes && leaf != leaves_.end())
+    {
+        const auto& block = *tree_.at(system::hash_cref(leaf->second));
+        if (&block == strongest_)
+        {
+            ++leaf;
+            continue;
+        }
+
+        auto it = heights_.lower_bound(leaf->first);
+        while (it != heights_.end() && it->second.get() != &block)
+            ++it;
+
+        BC_ASSERT(it != heights_.end());
+        remove(it);
+        ++count;
+        leaf = leaves_.begin();
+    }
+
+    return count;
+}
+
+TEMPLATE
+void CLASS::index(const Block& block) NOEXCEPT
+{
+    const auto& hash = block.get_hash();
+    const auto& previous = get_header(block).previous_block_hash();
+    const auto height = block.get_state()->height();
+
+    // The parent (if cached) is no longer a leaf.
+    if (is_one(++children_[previous]) && is_nonzero(height))
+        leaves_.erase({ sub1(height), previous });
+
+    if (!children_.contains(hash))
+        leaves_.emplace(height, hash);
+
+    if (!is_null(strongest_) && block.get_state()->cumulative_work() >
+        strongest_->get_state()->cumulative_work())
+        strongest_ = &block;
+}
+
+TEMPLATE
+void CLASS::unindex(const Block& block) NOEXCEPT
+{
+    const auto& hash = block.get_hash();
+    const auto& previous = get_header(block).previous_block_hash();
+    const auto height = block.get_state()->height();
+
+    leaves_.erase({ height, hash });
+    if (strongest_ == &block)
+        strongest_ = nullptr;
+
+    // The parent (if cached) becomes a leaf when its last child is removed.
+    const auto it = children_.find(previous);
+    if (it != children_.end() && is_zero(--it->second))
+    {
+        children_.erase(it);
+        if (is_nonzero(height) && tree_.contains(system::hash_cref(previous)))
+            leaves_.emplace(sub1(height), previous);
+    }
+}
+
+TEMPLATE
+typename CLASS::block_heights::iterator CLASS::remove(
+    typename block_heights::iterator it) NOEXCEPT
+{
+    // Block is retained by heights_ entry until it is erased.
+    unindex(*it->second);
+    tree_bytes_ -= get_allocation(*it->second);
+    tree_.erase(system::hash_cref(it->second->get_hash()));
+    return heights_.erase(it);
+}
+
+TEMPLATE
+void CLASS::forget(const Block& block) NOEXCEPT
+{
+    const auto range = heights_.equal_range(block.get_state()->height());
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.get() == &block)
+        {
+            unindex(block);
+            tree_bytes_ -= get_allocation(block);
+            heights_.erase(it);
+            return;
+        }
+    }
 }
 
 // Private getters
@@ -557,10 +749,64 @@ CLASS::chain_state::cptr CLASS::get_chain_state(
     if (it != tree_.end())
         return it->second->get_state();
 
+    // Recent candidate states are retained, as branches generally form near
+    // the top. A state is determined by its block hash, so is never stale.
+    for (const auto& recent: std::views::reverse(recent_))
+        if (recent->hash() == previous_hash)
+            return recent;
+
     // previous_hash may or not exist and/or be a candidate.
     return archive().get_chain_state(settings_, previous_hash);
 }
 
+TEMPLATE
+size_t CLASS::get_checkpoint(size_t height) const NOEXCEPT
+{
+    size_t top{};
+    for (const auto& checkpoint: checkpoints_)
+        if (checkpoint.height() <= height)
+            top = std::max(top, checkpoint.height());
+
+    return top;
+}
+
+TEMPLATE
+size_t CLASS::get_allocation(const Block& block) NOEXCEPT
+{
+    // Shared state and container overhead are not included.
+    if constexpr (is_block())
+        return block.serialized_size(true);
+    else
+        return system::chain::header::serialized_size();
+}
+
+TEMPLATE
+CLASS::chain_state::cptr CLASS::get_candidate_state(
+    size_t height) const NOEXCEPT
+{
+    // Retained states above a branch point are dropped upon reorganization,
+    // so these are always of the current candidate chain.
+    for (const auto& recent: std::views::reverse(recent_))
+        if (recent->height() == height)
+            return recent;
+
+    return archive().get_candidate_chain_state(settings_, height);
+}
+
+TEMPLATE
+void CLASS::remember(const chain_state::cptr& state,
+    size_t branch_point) NOEXCEPT
+{
+    // Drop states above branch point and any at or above the new state.
+    const auto top = std::min(branch_point, system::sub1(state->height()));
+    while (!recent_.empty() && recent_.back()->height() > top)
+        recent_.pop_back();
+
+    recent_.push_back(state);
+    if (recent_.size() > maximum_recent)
+        recent_.pop_front();
+}
+
 // Also obtains branch point for work summation termination.
 // Also obtains ordered branch identifiers for subsequent reorg.
 TEMPLATE
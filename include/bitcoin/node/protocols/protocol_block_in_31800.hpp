@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_NODE_PROTOCOLS_PROTOCOL_BLOCK_IN_31800_HPP
 #define LIBBITCOIN_NODE_PROTOCOLS_PROTOCOL_BLOCK_IN_31800_HPP
 
+#include <unordered_set>
 #include <bitcoin/node/chasers/chasers.hpp>
 #include <bitcoin/node/define.hpp>
 #include <bitcoin/node/protocols/protocol_performer.hpp>
@@ -41,6 +42,8 @@ public:
             session->config().bitcoin.top_checkpoint().height()),
         block_type_(session->config().network.witness_node() ?
             type_id::witness_block : type_id::block),
+        batches_(session->config().node.download_batches_()),
+        checks_(session->config().node.check_threads),
         map_(chaser_check::empty_map()),
         network::tracker<protocol_block_in_31800>(session->log)
     {
@@ -52,6 +55,10 @@ public:
     /// The channel is stopping (called on strand by stop subscription).
     void stopping(const code& ec) NOEXCEPT override;
 
+    /// Cache transaction hashes concurrently if at least the minimum count.
+    static constexpr size_t minimum_parallel_hashing = 256;
+    static void hash_transactions(const system::chain::block& block) NOEXCEPT;
+
 protected:
     /// Handle event subscription completion.
     void subscribed(const code& ec, object_key key) NOEXCEPT override;
@@ -67,6 +74,8 @@ protected:
     bool is_idle() const NOEXCEPT override;
     virtual void do_purge(channel_t) NOEXCEPT;
     virtual void do_split(channel_t) NOEXCEPT;
+    virtual void do_cancel(height_t height) NOEXCEPT;
+    virtual void do_shared(height_t height) NOEXCEPT;
     virtual void do_report(count_t count) NOEXCEPT;
 
     /// Check incoming block message.
@@ -76,11 +85,25 @@ protected:
 private:
     code check(const system::chain::block& block,
         const system::chain::context& ctx, bool bypass) const NOEXCEPT;
+    code check_block(const system::chain::block& block,
+        const database::header_link& link, const system::chain::context& ctx,
+        bool checked) const NOEXCEPT;
+    bool complete_block(const code& ec, const code& store,
+        const system::chain::block::cptr& block) NOEXCEPT;
+    bool redundant_block(const system::hash_digest& hash) NOEXCEPT;
+    void do_check_block(const system::chain::block::cptr& block,
+        const database::header_link& link, const system::chain::context& ctx,
+        bool checked) NOEXCEPT;
+    void handle_check_block(const code& ec, const code& store,
+        bool redundant, const system::chain::block::cptr& block,
+        size_t height) NOEXCEPT;
 
     void send_get_data(const map_ptr& map, const job::ptr& job) NOEXCEPT;
     network::messages::peer::get_data create_get_data(
         const database::associations& map) const NOEXCEPT;
 
+    void get_work() NOEXCEPT;
+    void get_next() NOEXCEPT;
     void restore(const map_ptr& map) NOEXCEPT;
     bool is_under_checkpoint(size_t height) const NOEXCEPT;
     void handle_put_hashes(const code& ec, size_t count) NOEXCEPT;
@@ -90,10 +113,16 @@ private:
     // These are thread safe.
     const size_t top_checkpoint_height_;
     const type_id block_type_;
+    const size_t batches_;
+    const size_t checks_;
 
     // These are protected by strand.
     map_ptr map_;
     job::ptr job_{};
+    size_t low_water_{};
+    bool fetching_{};
+    std::unordered_set<system::hash_digest> checking_{};
+    std::unordered_set<size_t> shared_{};
 
     std_vector<system::chain::block::cptr> blocks_{};
 };
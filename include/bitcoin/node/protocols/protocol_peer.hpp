@@ -61,7 +61,7 @@ protected:
         organize_handler&& handler) NOEXCEPT;
 
     /// Get block hashes for blocks to download.
-    virtual void get_hashes(map_handler&& handler) NOEXCEPT;
+    virtual void get_hashes(bool idle, map_handler&& handler) NOEXCEPT;
 
     /// Submit block hashes for blocks not downloaded.
     virtual void put_hashes(const map_ptr& map,
@@ -71,9 +71,18 @@ protected:
     /// -----------------------------------------------------------------------
 
     /// Report performance, handler may direct self-terminate.
-    virtual void performance(uint64_t speed,
+    /// Speed is bytes per second, latency is response milliseconds.
+    virtual void performance(uint64_t speed, uint64_t latency,
         network::result_handler&& handler) const NOEXCEPT;
 
+    /// Post work to the block check threadpool, false if not configured.
+    virtual bool post_check(work_handler&& work) const NOEXCEPT;
+
+    /// Archive a checked block, sets redundant if archived by another.
+    virtual code archive_block(bool& redundant,
+        const system::chain::block& block, const database::header_link& link,
+        bool checked) const NOEXCEPT;
+
     /// Suspend all existing and future network connections.
     /// A race condition could result in an unsuspended connection.
     virtual code fault(const code& ec) NOEXCEPT;
@@ -36,6 +36,10 @@ public:
     virtual void stop_performance() NOEXCEPT;
     virtual void count(size_t bytes) NOEXCEPT;
 
+    /// Time from the first request sent to the next response is latency.
+    virtual void requested() NOEXCEPT;
+    virtual void responded() NOEXCEPT;
+
 protected:
     protocol_performer(const auto& session,
         const network::channel::ptr& channel, bool enabled) NOEXCEPT
@@ -63,6 +67,9 @@ private:
 
     // These are protected by strand.
     uint64_t bytes_{ zero };
+    uint64_t latency_{ zero };
+    bool awaiting_{ false };
+    network::steady_clock::time_point requested_{};
     network::steady_clock::time_point start_{};
     network::deadline::ptr performance_timer_;
 };
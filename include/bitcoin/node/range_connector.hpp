@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_RANGE_CONNECTOR_HPP
+#define LIBBITCOIN_NODE_RANGE_CONNECTOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread SAFE connection of indexes [first, count) in ranges claimed from a
+/// shared cursor by any number of concurrent runners. Remaining ranges are
+/// skipped (but completed) once any index has failed. The error of the lowest
+/// failed index observed is retained, as if sequential.
+class BCN_API range_connector
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(range_connector);
+
+    typedef std::shared_ptr<range_connector> ptr;
+    typedef std::function<code(size_t index)> connector;
+
+    /// Connector must be thread safe, as it is invoked concurrently.
+    range_connector(size_t first, size_t count, size_t range,
+        connector&& connect) NOEXCEPT;
+
+    /// Number of ranges of [first, count).
+    size_t ranges() const NOEXCEPT;
+
+    /// Claim and connect ranges until all are claimed.
+    void run() NOEXCEPT;
+
+    /// Wait until all claimed ranges are connected, return first error.
+    /// Claimed ranges are in progress on running threads, so cannot deadlock.
+    code wait() NOEXCEPT;
+
+private:
+    // These are thread safe.
+    const size_t first_;
+    const size_t count_;
+    const size_t range_;
+    const connector connect_;
+    std::atomic<size_t> cursor_;
+    std::atomic<size_t> completed_;
+    std::atomic_bool failed_{};
+
+    // These are protected by mutex.
+    size_t index_{};
+    code ec_{};
+    std::mutex mutex_{};
+    std::condition_variable done_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
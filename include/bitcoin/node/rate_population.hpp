@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_RATE_POPULATION_HPP
+#define LIBBITCOIN_NODE_RATE_POPULATION_HPP
+
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/node/define.hpp>
+#include <bitcoin/node/rate_statistics.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread UNSAFE set of channel speeds and response latencies, with
+/// streaming statistics over each.
+class BCN_API rate_population
+{
+public:
+    typedef std::unordered_map<object_key, double> rates;
+    typedef std::vector<double> values;
+
+    /// Set the channel speed and latency, zero latency is not recorded.
+    void set(object_key channel, double speed, double latency) NOEXCEPT;
+
+    /// Remove the channel speed and latency.
+    void erase(object_key channel) NOEXCEPT;
+
+    /// Empty the set.
+    void clear() NOEXCEPT;
+
+    /// Channel speeds (bytes per second) and their statistics.
+    const rates& speeds() const NOEXCEPT;
+    const rate_statistics& speed() const NOEXCEPT;
+
+    /// Channel speeds in ascending order (order statistics).
+    const values& ordered() const NOEXCEPT;
+
+    /// Channel speed at the percentile (nearest rank, rounded down), zero
+    /// if empty. Percent is limited to 100.
+    double percentile(size_t percent) const NOEXCEPT;
+
+    /// Channel response latencies (milliseconds) and their statistics.
+    const rates& latencies() const NOEXCEPT;
+    const rate_statistics& latency() const NOEXCEPT;
+
+private:
+    static void set(rates& map, rate_statistics& statistics,
+        object_key channel, double value) NOEXCEPT;
+    static void erase(rates& map, rate_statistics& statistics,
+        object_key channel) NOEXCEPT;
+    void order(const rates& map, object_key channel, double value) NOEXCEPT;
+    void disorder(const rates& map, object_key channel) NOEXCEPT;
+
+    rates speeds_{};
+    rates latencies_{};
+    values ordered_{};
+    rate_statistics speed_{};
+    rate_statistics latency_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_RATE_STATISTICS_HPP
+#define LIBBITCOIN_NODE_RATE_STATISTICS_HPP
+
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread UNSAFE streaming (Welford) mean and variance over a set of rates.
+/// Supports removal and replacement of previously added rates in O(1).
+class BCN_API rate_statistics
+{
+public:
+    /// Add a rate to the set.
+    void add(double rate) NOEXCEPT;
+
+    /// Remove a previously added rate from the set.
+    void remove(double rate) NOEXCEPT;
+
+    /// Replace a previously added rate in the set.
+    void replace(double from, double to) NOEXCEPT;
+
+    /// Empty the set.
+    void clear() NOEXCEPT;
+
+    /// Number of rates in the set.
+    size_t count() const NOEXCEPT;
+
+    /// Arithmetic mean of the set (zero if empty).
+    double mean() const NOEXCEPT;
+
+    /// Sum of the set.
+    double total() const NOEXCEPT;
+
+    /// Sample variance of the set (zero if fewer than two).
+    double variance() const NOEXCEPT;
+
+    /// Sample standard deviation of the set (zero if fewer than two).
+    double deviation() const NOEXCEPT;
+
+private:
+    size_t count_{};
+    double mean_{};
+    double squares_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
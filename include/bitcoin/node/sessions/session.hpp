@@ -48,8 +48,9 @@ public:
         organize_handler&& handler) NOEXCEPT;
 
     /// Manage download queue.
-    virtual void get_hashes(map_handler&& handler) NOEXCEPT;
-    virtual void put_hashes(const map_ptr& map,
+    virtual void get_hashes(object_key channel, bool idle,
+        map_handler&& handler) NOEXCEPT;
+    virtual void put_hashes(object_key channel, const map_ptr& map,
         network::result_handler&& handler) NOEXCEPT;
 
     /// Events.
@@ -78,7 +79,15 @@ public:
 
     /// Handle performance, base returns false (implied terminate).
     virtual void performance(object_key channel, uint64_t speed,
-        network::result_handler&& handler) NOEXCEPT;
+        uint64_t latency, network::result_handler&& handler) NOEXCEPT;
+
+    /// Post work to the block check threadpool, false if not configured.
+    virtual bool post_check(work_handler&& work) NOEXCEPT;
+
+    /// Archive a checked block, sets redundant if archived by another.
+    virtual code archive_block(bool& redundant,
+        const system::chain::block& block, const database::header_link& link,
+        bool checked) NOEXCEPT;
 
     /// Get the memory resource.
     virtual network::memory& get_memory() const NOEXCEPT;
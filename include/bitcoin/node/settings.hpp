@@ -61,6 +61,14 @@ public:
 
 namespace node {
 
+/// Slow channel eviction policy.
+enum class eviction
+{
+    deviation,
+    percentile,
+    latency
+};
+
 /// [node] settings.
 class BCN_API settings
 {
@@ -74,22 +82,38 @@ public:
     bool headers_first;
     bool thread_priority;
     bool memory_priority;
+    bool allocation_mapping;
+    bool allocation_adaptive;
     float allowed_deviation;
     uint16_t announcement_cache;
     uint16_t allocation_multiple;
+    uint64_t allocation_retention;
     ////uint64_t snapshot_bytes;
     ////uint32_t snapshot_valid;
     ////uint32_t snapshot_confirm;
     uint32_t maximum_height;
     uint32_t maximum_concurrency;
+    uint32_t endgame_blocks;
+    uint16_t download_batches;
+    std::string slow_policy;
+    uint16_t slow_percentile;
     uint16_t sample_period_seconds;
     uint32_t currency_window_minutes;
+    uint32_t check_threads;
+    uint32_t confirm_batch;
+    uint32_t confirm_window;
+    uint32_t prefetch_blocks;
+    uint32_t populate_threads;
+    uint64_t backlog_bytes;
+    uint64_t tree_bytes;
     uint32_t threads;
 
     /// Helpers.
     virtual size_t threads_() const NOEXCEPT;
     virtual size_t maximum_height_() const NOEXCEPT;
     virtual size_t maximum_concurrency_() const NOEXCEPT;
+    virtual size_t download_batches_() const NOEXCEPT;
+    virtual eviction slow_policy_() const NOEXCEPT;
     virtual network::steady_clock::duration sample_period() const NOEXCEPT;
     virtual network::wall_clock::duration currency_window() const NOEXCEPT;
     virtual network::processing_priority thread_priority_() const NOEXCEPT;
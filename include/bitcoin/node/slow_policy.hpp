@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_SLOW_POLICY_HPP
+#define LIBBITCOIN_NODE_SLOW_POLICY_HPP
+
+#include <memory>
+#include <vector>
+#include <bitcoin/node/define.hpp>
+#include <bitcoin/node/rate_population.hpp>
+#include <bitcoin/node/settings.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Abstract slow channel eviction policy, thread safe (stateless).
+/// Policies evaluate a channel against the current population of channel
+/// rates, in which the channel's own most recent rates are already recorded.
+class BCN_API slow_policy
+{
+public:
+    typedef std::unique_ptr<const slow_policy> ptr;
+
+    /// A recorded channel performance report (as passed to chaser_check).
+    struct sample
+    {
+        object_key channel;
+        uint64_t speed;
+        uint64_t latency;
+    };
+
+    typedef std::vector<sample> trace;
+
+    /// Outcome of a trace replay (throughput is the sum of sample speeds).
+    struct replay_result
+    {
+        size_t samples;
+        size_t evictions;
+        double throughput;
+    };
+
+    /// Fewer population members than this do not support eviction.
+    static constexpr size_t minimum_population = 3;
+
+    /// Create the policy selected by configuration.
+    static ptr create(const settings& config) NOEXCEPT;
+
+    /// Feed a recorded trace through the policy, accumulating the speed of
+    /// each sample. An evicted channel's connection slot is refilled, so its
+    /// further samples are replaced by the mean speed of the population at
+    /// eviction (the expected speed of a new connection). Zero speed (stalled)
+    /// and max_uint64 speed (exhausted) samples remove the channel from the
+    /// population, as they do in chaser_check.
+    static replay_result replay(const slow_policy& policy,
+        const trace& records) NOEXCEPT;
+
+    virtual ~slow_policy() = default;
+
+    /// True if the channel should be dropped as slow.
+    virtual bool is_slow(object_key channel,
+        const rate_population& population) const NOEXCEPT = 0;
+};
+
+/// Slow if speed is more than allowed deviations below the mean speed.
+class BCN_API deviation_policy
+  : public slow_policy
+{
+public:
+    deviation_policy(float allowed_deviation) NOEXCEPT;
+
+    bool is_slow(object_key channel,
+        const rate_population& population) const NOEXCEPT override;
+
+private:
+    const double allowed_deviation_;
+};
+
+/// Slow if speed is below the configured percentile of speeds.
+class BCN_API percentile_policy
+  : public slow_policy
+{
+public:
+    percentile_policy(uint16_t percentile) NOEXCEPT;
+
+    bool is_slow(object_key channel,
+        const rate_population& population) const NOEXCEPT override;
+
+private:
+    const size_t percentile_;
+};
+
+/// Slow if response latency (first request to first requested block) is more
+/// than allowed deviations above the mean latency. Channels without a latency
+/// measurement are not slow.
+class BCN_API latency_policy
+  : public slow_policy
+{
+public:
+    latency_policy(float allowed_deviation) NOEXCEPT;
+
+    bool is_slow(object_key channel,
+        const rate_population& population) const NOEXCEPT override;
+
+private:
+    const double allowed_deviation_;
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
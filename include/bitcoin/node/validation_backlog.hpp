@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_VALIDATION_BACKLOG_HPP
+#define LIBBITCOIN_NODE_VALIDATION_BACKLOG_HPP
+
+#include <atomic>
+#include <mutex>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread SAFE adaptive limit on outstanding block validations.
+/// The limit is adjusted once per window of completed validations (one per
+/// validation thread) from validation cost per byte, outstanding bytes and
+/// worker utilization (validation stages posted to and awaiting a worker).
+class BCN_API validation_backlog
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(validation_backlog);
+
+    /// The constraint that determined the limit over the last window.
+    enum class bound : uint8_t
+    {
+        /// Window incomplete, limit unchanged.
+        none,
+
+        /// Validation cost is stable, limit increased (up to maximum) if
+        /// workers idled, held if always busy, decreased if always queued.
+        cpu,
+
+        /// Validation cost rises with concurrency, limit decreased.
+        store,
+
+        /// Outstanding block bytes exceed memory limit, limit halved.
+        memory
+    };
+
+    /// Cost above this multiple of the baseline cost implies store-bound.
+    static constexpr double store_ratio = 1.5;
+
+    /// The limit is bounded by [threads, maximum], starting at maximum.
+    /// Memory limit is the maximum bytes of outstanding blocks (0 disables).
+    validation_backlog(size_t threads, size_t maximum,
+        uint64_t memory) NOEXCEPT;
+
+    /// Current limit on outstanding validations.
+    size_t limit() const NOEXCEPT;
+
+    /// Total bytes of blocks obtained and not yet completed.
+    uint64_t outstanding() const NOEXCEPT;
+
+    /// Validation stages posted to a threadpool and not yet started.
+    size_t queued() const NOEXCEPT;
+
+    /// Record that a validation stage has been posted to a threadpool.
+    void queue() NOEXCEPT;
+
+    /// Record that a posted validation stage has been started by a worker.
+    void dequeue() NOEXCEPT;
+
+    /// Record that a block of the given size has been obtained by a worker.
+    void started(size_t bytes) NOEXCEPT;
+
+    /// Record validation completion of the given block size and duration.
+    /// A zero size (block not obtained) is not included in the window.
+    /// Returns the window's constraint, limit() reflects any adjustment.
+    bound completed(size_t bytes, uint64_t microseconds) NOEXCEPT;
+
+private:
+    bound adjust() NOEXCEPT;
+
+    // These are thread safe.
+    const size_t minimum_;
+    const size_t maximum_;
+    const size_t window_;
+    const uint64_t memory_;
+    std::atomic_size_t limit_;
+    std::atomic<uint64_t> outstanding_{};
+
+    // These are protected by mutex.
+    size_t queued_{};
+    size_t waiting_{ max_size_t };
+    size_t count_{};
+    uint64_t bytes_{};
+    uint64_t microseconds_{};
+    uint64_t peak_{};
+    double baseline_{};
+    mutable std::mutex mutex_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
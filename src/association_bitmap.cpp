@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/association_bitmap.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+constexpr auto word_bits = to_bits(sizeof(uint64_t));
+
+void association_bitmap::clear(size_t base) NOEXCEPT
+{
+    base_ = top_ = base;
+    bits_.clear();
+}
+
+size_t association_bitmap::base() const NOEXCEPT
+{
+    return base_;
+}
+
+size_t association_bitmap::top() const NOEXCEPT
+{
+    return top_;
+}
+
+void association_bitmap::set(size_t height) NOEXCEPT
+{
+    // Heights above top_ are loaded by load.
+    if (height <= base_ || height > top_)
+        return;
+
+    const auto index = height - add1(base_);
+    bits_.at(index / word_bits) |= power2<uint64_t>(index % word_bits);
+}
+
+void association_bitmap::reset(size_t branch_point) NOEXCEPT
+{
+    if (branch_point >= top_)
+        return;
+
+    // Heights below the base are not tracked, reload from branch point.
+    if (branch_point <= base_)
+    {
+        clear(branch_point);
+        return;
+    }
+
+    // Clear bits above the branch point.
+    const auto count = branch_point - base_;
+    bits_.resize(ceilinged_divide(count, word_bits));
+    if (const auto offset = count % word_bits; is_nonzero(offset))
+        bits_.back() &= sub1(power2<uint64_t>(offset));
+
+    top_ = branch_point;
+}
+
+void association_bitmap::load(size_t top, const predicate& associated) NOEXCEPT
+{
+    if (top <= top_)
+        return;
+
+    bits_.resize(ceilinged_divide(top - base_, word_bits));
+    while (top_ < top)
+    {
+        top_ = add1(top_);
+        if (associated(top_))
+            set(top_);
+    }
+}
+
+size_t association_bitmap::to_unassociated(size_t height) const NOEXCEPT
+{
+    // Word-at-a-time scan for the first unset bit at or above height.
+    auto index = floored_subtract(height, add1(base_));
+    const auto end = bits_.size() * word_bits;
+    while (index < end)
+    {
+        const auto offset = index % word_bits;
+        const auto word = bits_.at(index / word_bits) >> offset;
+        const auto ones = possible_narrow_sign_cast<size_t>(
+            std::countr_one(word));
+
+        if (ones < word_bits - offset)
+            return add1(base_) + index + ones;
+
+        index += word_bits - offset;
+    }
+
+    return add1(base_) + std::max(index, end);
+}
+
+size_t association_bitmap::count_unassociated(size_t above,
+    size_t limit) const NOEXCEPT
+{
+    const auto first = std::max(above, base_);
+    const auto last = std::min(ceilinged_add(above, limit), top_);
+    if (first >= last)
+        return zero;
+
+    // Word-at-a-time population count of set bits in (first, last].
+    auto associated = zero;
+    auto index = first - base_;
+    const auto end = last - base_;
+    while (index < end)
+    {
+        const auto offset = index % word_bits;
+        const auto span = std::min(word_bits - offset, end - index);
+        auto word = bits_.at(index / word_bits) >> offset;
+        if (span < word_bits)
+            word &= sub1(power2<uint64_t>(span));
+
+        associated += possible_narrow_sign_cast<size_t>(std::popcount(word));
+        index += span;
+    }
+
+    return (last - first) - associated;
+}
+
+size_t association_bitmap::advance(size_t position, size_t window,
+    size_t candidate, const predicate& associated) NOEXCEPT
+{
+    if (candidate < top_)
+        reset(candidate);
+
+    // Each pass loads one window above the run, so a run of associated
+    // heights longer than the window is crossed in as many passes. Returns
+    // once the first unset height has been loaded (or is above candidate).
+    auto height = add1(position);
+    while (true)
+    {
+        load(std::min(candidate, ceilinged_add(sub1(height), window)),
+            associated);
+
+        const auto next = to_unassociated(height);
+        if (next == height)
+            return height;
+
+        height = next;
+    }
+}
+
+} // namespace node
+} // namespace libbitcoin
@@ -19,50 +19,110 @@
 #include <bitcoin/node/block_arena.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <bitcoin/system.hpp>
 
+#if !defined(HAVE_MSC)
+    #include <sys/mman.h>
+#endif
+#if defined(__linux__)
+    #include <linux/mempolicy.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
 namespace libbitcoin {
 namespace node {
 
 using namespace system;
 
+#if defined(MAP_HUGETLB)
+// Probe for reserved explicit huge pages by mapping (and unmapping) one.
+static bool is_reserved(size_t huge_page) NOEXCEPT
+{
+    constexpr auto access = PROT_READ | PROT_WRITE;
+    constexpr auto flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+    const auto map = ::mmap(nullptr, huge_page, access, flags, -1, 0);
+    if (map == MAP_FAILED)
+        return false;
+
+    ::munmap(map, huge_page);
+    return true;
+}
+#endif
+
 // construct/destruct/assign
 // ----------------------------------------------------------------------------
 
-block_arena::block_arena(size_t multiple) NOEXCEPT
-  : memory_map_{ nullptr },
+block_arena::block_arena(size_t multiple, block_pool* pool, bool mapped,
+    block_telemetry* telemetry, bool adaptive) NOEXCEPT
+  : pool_{ pool },
+    telemetry_{ telemetry },
+    mapped_{ mapped },
+    adaptive_{ adaptive },
+    memory_map_{ nullptr },
     multiple_{ multiple },
     offset_{ zero },
     total_{ zero },
-    size_{ zero }
+    size_{ zero },
+    wire_{ zero },
+    chunks_{ zero },
+    allocated_{ zero },
+    mean_{ 0.0 },
+    deviation_{ 0.0 }
 {
 }
 
 block_arena::block_arena(block_arena&& other) NOEXCEPT
-  : memory_map_{ other.memory_map_ },
+  : pool_{ other.pool_ },
+    telemetry_{ other.telemetry_ },
+    mapped_{ other.mapped_ },
+    adaptive_{ other.adaptive_ },
+    memory_map_{ other.memory_map_ },
     multiple_{ other.multiple_ },
     offset_{ other.offset_ },
     total_{ other.total_ },
-    size_{ other.size_ }
+    size_{ other.size_ },
+    wire_{ other.wire_ },
+    chunks_{ other.chunks_ },
+    allocated_{ other.allocated_ },
+    mean_{ other.mean_ },
+    deviation_{ other.deviation_ }
 {
     // Prevents free(memory_map_) as responsibility is passed to this object.
     other.memory_map_ = nullptr;
+    other.pool_ = nullptr;
 }
 
 block_arena::~block_arena() NOEXCEPT
 {
+    // Retained chunks are freed by their owning arena.
+    if (!is_null(pool_))
+        for (const auto chunk: pool_->clear())
+            free_chunk(std::prev(chunk, chunk_prefix));
 }
 
 block_arena& block_arena::operator=(block_arena&& other) NOEXCEPT
 {
+    pool_ = other.pool_;
+    telemetry_ = other.telemetry_;
+    mapped_ = other.mapped_;
+    adaptive_ = other.adaptive_;
     memory_map_ = other.memory_map_;
     multiple_ = other.multiple_;
     offset_ = other.offset_;
     total_ = other.total_;
     size_ = other.size_;
+    wire_ = other.wire_;
+    chunks_ = other.chunks_;
+    allocated_ = other.allocated_;
+    mean_ = other.mean_;
+    deviation_ = other.deviation_;
 
     // Prevents free(memory_map_) as responsibility is passed to this object.
     other.memory_map_ = nullptr;
+    other.pool_ = nullptr;
     return *this;
 }
 
@@ -71,36 +131,193 @@ block_arena& block_arena::operator=(block_arena&& other) NOEXCEPT
 
 void* block_arena::start(size_t wire_size) THROWS
 {
-    if (is_multiply_overflow(wire_size, multiple_))
-        throw allocation_exception{};
-
-    size_ = wire_size * multiple_;
+    size_ = to_first(wire_size);
     memory_map_ = nullptr;
     offset_ = zero;
     total_ = zero;
+    wire_ = wire_size;
+    chunks_ = zero;
+    allocated_ = zero;
     push();
     return memory_map_;
 }
 
 size_t block_arena::detach() NOEXCEPT
 {
+    const auto consumed = total_ + offset_;
+    if (!is_null(telemetry_))
+        telemetry_->record(wire_, consumed, allocated_, chunks_);
+
+    if (adaptive_)
+        adapt(consumed);
+
     memory_map_ = nullptr;
-    return total_ + offset_;
+    return consumed;
 }
 
 void block_arena::release(void* address) NOEXCEPT
 {
     while (!is_null(address))
     {
-        const auto link = get_link(pointer_cast<uint8_t>(address));
-        free_(address);
-        address = link;
+        const auto chunk = pointer_cast<uint8_t>(address);
+        address = get_link(chunk);
+        put_chunk(chunk);
     }
 }
 
 // protected
 // ----------------------------------------------------------------------------
 
+void* block_arena::map_(size_t bytes) THROWS
+{
+#if defined(HAVE_MSC)
+    // Mapping is not implemented for windows.
+    return malloc_(bytes);
+#else
+    constexpr auto access = PROT_READ | PROT_WRITE;
+    constexpr auto flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    auto map = MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+    // Explicit huge pages must be reserved by the system (nr_hugepages).
+    // Reservation is probed once and abandoned upon exhaustion, otherwise each
+    // chunk incurs a failing syscall before falling back to advised mapping.
+    static std::atomic_bool reserved{ is_reserved(huge_page) };
+    if (is_zero(bytes % huge_page) && reserved.load(std::memory_order_relaxed))
+    {
+        map = ::mmap(nullptr, bytes, access, flags | MAP_HUGETLB, -1, 0);
+        if (map == MAP_FAILED)
+            reserved.store(false, std::memory_order_relaxed);
+    }
+#endif
+
+    if (map == MAP_FAILED)
+    {
+        map = ::mmap(nullptr, bytes, access, flags, -1, 0);
+        if (map == MAP_FAILED)
+            return nullptr;
+
+#if defined(MADV_HUGEPAGE)
+        // Transparent huge pages are advisory, failure is inconsequential.
+        if (bytes >= huge_page)
+            ::madvise(map, bytes, MADV_HUGEPAGE);
+#endif
+    }
+
+#if defined(__linux__)
+    // Prefer the allocating thread's node, regardless of first touch.
+    // Raw syscalls avoid a libnuma dependency, failure is inconsequential.
+    unsigned cpu{}, node{};
+    constexpr auto nodes = to_bits(sizeof(unsigned long));
+    if (is_zero(::syscall(SYS_getcpu, &cpu, &node, nullptr)) &&
+        node < sub1(nodes))
+    {
+        const auto mask = power2<unsigned long>(node);
+        ::syscall(SYS_mbind, map, bytes, MPOL_PREFERRED, &mask, nodes, 0);
+    }
+#endif
+
+    return map;
+#endif
+}
+
+void block_arena::unmap_(void* address, size_t bytes) NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    free_(address);
+#else
+    ::munmap(address, bytes);
+#endif
+}
+
+uint8_t* block_arena::get_chunk(size_t& size) THROWS
+{
+    if (!is_prefixed())
+        return pointer_cast<uint8_t>(malloc_(size));
+
+    // Pooled chunk capacity is extended to its size class, which is reusable.
+    if (!is_null(pool_))
+    {
+        size = block_pool::to_class(size);
+        if (const auto chunk = pool_->get(size))
+            return chunk;
+    }
+
+    if (is_add_overflow(size, chunk_prefix + huge_page))
+        throw allocation_exception{};
+
+    const auto base = pointer_cast<uint8_t>(mapped_ ? map_(to_mapped(size)) :
+        malloc_(size + chunk_prefix));
+
+    if (is_null(base))
+        return nullptr;
+
+    set_prefix(base, size);
+    return std::next(base, chunk_prefix);
+}
+
+void block_arena::put_chunk(uint8_t* chunk) NOEXCEPT
+{
+    if (!is_prefixed())
+    {
+        free_(chunk);
+        return;
+    }
+
+    // Chunk is freed if not pooled or the pool is at its retention limit.
+    const auto base = std::prev(chunk, chunk_prefix);
+    if (is_null(pool_) || !pool_->put(chunk, get_prefix(base)))
+        free_chunk(base);
+}
+
+void block_arena::free_chunk(uint8_t* base) NOEXCEPT
+{
+    if (mapped_)
+        unmap_(base, to_mapped(get_prefix(base)));
+    else
+        free_(base);
+}
+
+size_t block_arena::to_first(size_t wire_size) const THROWS
+{
+    // Fixed multiple until there is an observation.
+    if (!adaptive_ || mean_ <= 0.0)
+    {
+        if (is_multiply_overflow(wire_size, multiple_))
+            throw allocation_exception{};
+
+        return wire_size * multiple_;
+    }
+
+    // As with tcp rto, four deviations above the mean avoids most overflows.
+    const auto bytes = std::ceil(to_floating(wire_size) *
+        (mean_ + 4.0 * deviation_));
+
+    if (bytes >= to_floating(max_size_t))
+        throw allocation_exception{};
+
+    return static_cast<size_t>(bytes);
+}
+
+void block_arena::adapt(size_t consumed) NOEXCEPT
+{
+    if (is_zero(wire_))
+        return;
+
+    // Smoothing factors (1/8 mean, 1/4 deviation) are those of tcp srtt.
+    const auto ratio = to_floating(consumed) / to_floating(wire_);
+    if (mean_ <= 0.0)
+    {
+        mean_ = ratio;
+        deviation_ = ratio / 2.0;
+        return;
+    }
+
+    const auto error = ratio - mean_;
+    mean_ += error / 8.0;
+    deviation_ += (std::abs(error) - deviation_) / 4.0;
+}
+
 void block_arena::push(size_t minimum) THROWS
 {
     static constexpr size_t link_size = sizeof(void*);
@@ -108,11 +325,14 @@ void block_arena::push(size_t minimum) THROWS
     // Ensure next allocation accomodates link plus current request.
     BC_ASSERT(!is_add_overflow(minimum, link_size));
     size_ = std::max(size_, minimum + link_size);
-    const auto map = pointer_cast<uint8_t>(malloc_(size_));
+    const auto map = get_chunk(size_);
 
     if (is_null(map))
         throw allocation_exception{};
 
+    ++chunks_;
+    allocated_ += size_;
+
     // Set previous chunk's link pointer to the new allocation.
     set_link(map);
     memory_map_ = map;
@@ -19,6 +19,7 @@
 #include <bitcoin/node/block_memory.hpp>
 
 #include <atomic>
+#include <numeric>
 
 namespace libbitcoin {
 namespace node {
@@ -31,7 +32,31 @@ block_memory::block_memory(size_t multiple, size_t threads) NOEXCEPT
     {
         arenas_.reserve(threads);
         for (auto index = zero; index < threads; ++index)
-            arenas_.emplace_back(multiple);
+            arenas_.emplace_back(multiple, nullptr, false, &telemetry_);
+    }
+}
+
+block_memory::block_memory(size_t multiple, size_t threads, size_t retain,
+    bool mapped, bool adaptive) NOEXCEPT
+{
+    if (is_nonzero(multiple))
+    {
+        arenas_.reserve(threads);
+        for (auto index = zero; index < threads; ++index)
+        {
+            if (is_zero(retain))
+            {
+                arenas_.emplace_back(multiple, nullptr, mapped, &telemetry_,
+                    adaptive);
+            }
+            else
+            {
+                // Each arena recycles through its own (owning thread) pool.
+                pools_.emplace_back(retain);
+                arenas_.emplace_back(multiple, &pools_.back(), mapped,
+                    &telemetry_, adaptive);
+            }
+        }
     }
 }
 
@@ -41,6 +66,38 @@ arena* block_memory::get_arena() NOEXCEPT
     return thread < arenas_.size() ? &arenas_.at(thread) : default_arena::get();
 }
 
+size_t block_memory::hits() const NOEXCEPT
+{
+    return std::accumulate(pools_.begin(), pools_.end(), zero,
+        [](size_t sum, const block_pool& pool) NOEXCEPT
+        {
+            return sum + pool.hits();
+        });
+}
+
+size_t block_memory::misses() const NOEXCEPT
+{
+    return std::accumulate(pools_.begin(), pools_.end(), zero,
+        [](size_t sum, const block_pool& pool) NOEXCEPT
+        {
+            return sum + pool.misses();
+        });
+}
+
+size_t block_memory::retained() const NOEXCEPT
+{
+    return std::accumulate(pools_.begin(), pools_.end(), zero,
+        [](size_t sum, const block_pool& pool) NOEXCEPT
+        {
+            return sum + pool.retained();
+        });
+}
+
+const block_telemetry& block_memory::telemetry() const NOEXCEPT
+{
+    return telemetry_;
+}
+
 BC_POP_WARNING()
 
 } // namespace node
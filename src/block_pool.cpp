@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/block_pool.hpp>
+
+#include <mutex>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+block_pool::block_pool(size_t limit) NOEXCEPT
+  : limit_(limit)
+{
+}
+
+uint8_t* block_pool::get(size_t size) NOEXCEPT
+{
+    uint8_t* chunk{};
+    {
+        std::lock_guard lock(mutex_);
+        const auto it = chunks_.find(size);
+        if (it != chunks_.end() && !it->second.empty())
+        {
+            chunk = it->second.back();
+            it->second.pop_back();
+            retained_.fetch_sub(size, std::memory_order_relaxed);
+        }
+    }
+
+    if (is_null(chunk))
+    {
+        misses_.fetch_add(one, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    hits_.fetch_add(one, std::memory_order_relaxed);
+    return chunk;
+}
+
+bool block_pool::put(uint8_t* chunk, size_t size) NOEXCEPT
+{
+    BC_ASSERT(!is_null(chunk));
+    std::lock_guard lock(mutex_);
+    const auto retained = retained_.load(std::memory_order_relaxed);
+    if (is_add_overflow(retained, size) || (retained + size) > limit_)
+        return false;
+
+    chunks_[size].push_back(chunk);
+    retained_.fetch_add(size, std::memory_order_relaxed);
+    return true;
+}
+
+std::vector<uint8_t*> block_pool::clear() NOEXCEPT
+{
+    std::vector<uint8_t*> out{};
+    std::lock_guard lock(mutex_);
+    for (auto& bucket: chunks_)
+        out.insert(out.end(), bucket.second.begin(), bucket.second.end());
+
+    chunks_.clear();
+    retained_.store(zero, std::memory_order_relaxed);
+    return out;
+}
+
+size_t block_pool::hits() const NOEXCEPT
+{
+    return hits_.load(std::memory_order_relaxed);
+}
+
+size_t block_pool::misses() const NOEXCEPT
+{
+    return misses_.load(std::memory_order_relaxed);
+}
+
+size_t block_pool::retained() const NOEXCEPT
+{
+    return retained_.load(std::memory_order_relaxed);
+}
+
+BC_POP_WARNING()
+
+} // namespace node
+} // namespace libbitcoin
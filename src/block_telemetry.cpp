@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/block_telemetry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+constexpr auto relaxed = std::memory_order_relaxed;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+block_telemetry::block_telemetry() NOEXCEPT
+  : blocks_{}, overflows_{}, wire_{}, consumed_{}, allocated_{},
+    ratios_{}, chunks_{}
+{
+}
+
+void block_telemetry::record(size_t wire, size_t consumed, size_t allocated,
+    size_t chunks) NOEXCEPT
+{
+    // Empty allocations have no meaningful ratio.
+    if (is_zero(wire) || is_zero(chunks))
+        return;
+
+    blocks_.fetch_add(one, relaxed);
+    wire_.fetch_add(wire, relaxed);
+    consumed_.fetch_add(consumed, relaxed);
+    allocated_.fetch_add(allocated, relaxed);
+
+    if (chunks > one)
+        overflows_.fetch_add(one, relaxed);
+
+    const auto ratio = ceilinged_divide(consumed, wire);
+    ratios_.at(std::min(ratio, sub1(ratio_buckets))).fetch_add(one, relaxed);
+    chunks_.at(std::min(chunks, sub1(chunk_buckets))).fetch_add(one, relaxed);
+}
+
+size_t block_telemetry::blocks() const NOEXCEPT
+{
+    return blocks_.load(relaxed);
+}
+
+size_t block_telemetry::overflows() const NOEXCEPT
+{
+    return overflows_.load(relaxed);
+}
+
+size_t block_telemetry::wire_bytes() const NOEXCEPT
+{
+    return wire_.load(relaxed);
+}
+
+size_t block_telemetry::consumed_bytes() const NOEXCEPT
+{
+    return consumed_.load(relaxed);
+}
+
+size_t block_telemetry::allocated_bytes() const NOEXCEPT
+{
+    return allocated_.load(relaxed);
+}
+
+block_telemetry::ratios block_telemetry::consumed_ratios() const NOEXCEPT
+{
+    ratios out{};
+    for (auto index = zero; index < ratio_buckets; ++index)
+        out.at(index) = ratios_.at(index).load(relaxed);
+
+    return out;
+}
+
+block_telemetry::chunks block_telemetry::chunk_counts() const NOEXCEPT
+{
+    chunks out{};
+    for (auto index = zero; index < chunk_buckets; ++index)
+        out.at(index) = chunks_.at(index).load(relaxed);
+
+    return out;
+}
+
+size_t block_telemetry::multiple(double percent) const NOEXCEPT
+{
+    const auto histogram = consumed_ratios();
+    const auto total = std::accumulate(histogram.begin(), histogram.end(),
+        zero);
+
+    if (is_zero(total))
+        return zero;
+
+    // Consumed includes the chunk link, so ratio is the sufficient multiple.
+    const auto target = std::clamp(percent, 0.0, 100.0) * total / 100.0;
+    auto sum = zero;
+    for (auto ratio = zero; ratio < ratio_buckets; ++ratio)
+        if (to_floating(sum += histogram.at(ratio)) >= target)
+            return std::max(ratio, one);
+
+    return ratio_buckets;
+}
+
+BC_POP_WARNING()
+
+} // namespace node
+} // namespace libbitcoin
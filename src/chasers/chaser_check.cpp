@@ -47,7 +47,8 @@ chaser_check::chaser_check(full_node& node) NOEXCEPT
     maximum_concurrency_(node.config().node.maximum_concurrency_()),
     maximum_height_(node.config().node.maximum_height_()),
     connections_(node.config().network.outbound_connections),
-    allowed_deviation_(node.config().node.allowed_deviation)
+    policy_(slow_policy::create(node.config().node)),
+    endgame_blocks_(node.config().node.endgame_blocks)
 {
 }
 
@@ -75,6 +76,10 @@ code chaser_check::start() NOEXCEPT
     start_tracking();
     set_position(archive().get_fork());
     requested_ = advanced_ = position();
+
+    // Association bitmap is loaded on demand, subsequently tracked by event.
+    associated_.clear(position());
+
     const auto added = set_unassociated();
     LOGN("Fork point (" << requested_ << ") unassociated (" << added << ").");
 
@@ -199,22 +204,22 @@ void chaser_check::do_starved(object_t self) NOEXCEPT
     BC_ASSERT(stranded());
 
     // Remove the starved channel to prevent self-selection.
-    if (speeds_.find(self) != speeds_.end())
-        speeds_.erase(self);
+    population_.erase(self);
 
     // Find the slowest reporting channel.
-    const auto slowest = std::min_element(speeds_.begin(), speeds_.end(),
+    const auto& speeds = population_.speeds();
+    const auto slowest = std::min_element(speeds.begin(), speeds.end(),
         [](const auto& left, const auto& right) NOEXCEPT
         {
             return left.second < right.second;
         });
 
     // Direct the slowest channel to split work and stop.
-    if (slowest != speeds_.end())
+    if (slowest != speeds.end())
     {
         // Erase entry so less likely to be claimed again before stopping.
         const auto slow = slowest->first;
-        speeds_.erase(slowest);
+        population_.erase(slow);
 
         // Notify slow channel to split itself (in favor of 'self' channel).
         notify_one(slow, error::success, chase::split, self);
@@ -229,7 +234,7 @@ void chaser_check::do_starved(object_t self) NOEXCEPT
 // ----------------------------------------------------------------------------
 
 void chaser_check::update(object_key channel, uint64_t speed,
-    network::result_handler&& handler) NOEXCEPT
+    uint64_t latency, network::result_handler&& handler) NOEXCEPT
 {
     if (closed())
     {
@@ -238,7 +243,7 @@ void chaser_check::update(object_key channel, uint64_t speed,
     }
 
     boost::asio::post(strand(),
-        BIND(do_update, channel, speed, handler));
+        BIND(do_update, channel, speed, latency, handler));
 }
 
 std::string to_kilobits_per_second(double value) NOEXCEPT
@@ -249,13 +254,13 @@ std::string to_kilobits_per_second(double value) NOEXCEPT
 }
 
 void chaser_check::do_update(object_key channel, uint64_t speed,
-    const network::result_handler& handler) NOEXCEPT
+    uint64_t latency, const network::result_handler& handler) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
     if (speed == max_uint64)
     {
-        speeds_.erase(channel);
+        population_.erase(channel);
         handler(error::exhausted_channel);
         return;
     }
@@ -263,58 +268,68 @@ void chaser_check::do_update(object_key channel, uint64_t speed,
     // Always remove record on stalled channel (and channel close).
     if (is_zero(speed))
     {
-        speeds_.erase(channel);
+        population_.erase(channel);
         handler(error::stalled_channel);
         return;
     }
 
     // Integer to floating point.
-    speeds_[channel] = to_floating(speed);
+    population_.set(channel, to_floating(speed), to_floating(latency));
 
-    // Three elements are required to measure deviation, don't drop below.
-    const auto count = speeds_.size();
-    if (count <= minimum_for_standard_deviation)
+    // The configured policy determines slow, channel remains recorded.
+    const auto slow = policy_->is_slow(channel, population_);
+
+    // Three elements are required to measure deviation, don't log below.
+    const auto& statistics = population_.speed();
+    const auto count = statistics.count();
+    const auto mean = statistics.mean();
+    if (count > minimum_for_standard_deviation && (slow || speed < mean))
     {
-        handler(error::success);
-        return;
+        // Only slow or speed < mean channels are logged.
+        LOGV("Below average channel (" << count << ") rate ("
+            << to_kilobits_per_second(statistics.total()) << ") mean ("
+            << to_kilobits_per_second(mean) << ") sdev ("
+            << to_kilobits_per_second(statistics.deviation()) << ") Kbps ["
+            << (slow ? "*" : "") << to_kilobits_per_second(to_floating(speed))
+            << "] latency (" << latency << ") ms.");
     }
 
-    const auto rate = std::accumulate(speeds_.begin(), speeds_.end(), 0.0,
-        [](double sum, const auto& element) NOEXCEPT
-        {
-            return sum + element.second;
-        });
-
-    const auto mean = rate / count;
-    if (speed >= mean)
+    if (slow)
     {
-        handler(error::success);
+        handler(error::slow_channel);
         return;
     }
 
-    const auto variance = std::accumulate(speeds_.begin(), speeds_.end(), 0.0,
-        [mean](double sum, const auto& element) NOEXCEPT
-        {
-            return sum + std::pow(element.second - mean, two);
-        }) / (sub1(count));
-
-    const auto sdev = std::sqrt(variance);
-    const auto slow = (mean - speed) > (allowed_deviation_ * sdev);
+    handler(error::success);
+}
 
-    // Only speed < mean channels are logged.
-    LOGV("Below average channel (" << count << ") rate ("
-        << to_kilobits_per_second(rate) << ") mean ("
-        << to_kilobits_per_second(mean) << ") sdev ("
-        << to_kilobits_per_second(sdev) << ") Kbps [" << (slow ? "*" : "")
-        << to_kilobits_per_second(to_floating(speed)) << "].");
+// rates
+// ----------------------------------------------------------------------------
 
-    if (slow)
+void chaser_check::get_rates(rates_handler&& handler) NOEXCEPT
+{
+    if (closed())
     {
-        handler(error::slow_channel);
+        handler(network::error::service_stopped, {});
         return;
     }
 
-    handler(error::success);
+    POST(do_get_rates, std::move(handler));
+}
+
+void chaser_check::do_get_rates(const rates_handler& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    const auto& statistics = population_.speed();
+    const rates snapshot
+    {
+        statistics.count(),
+        statistics.mean(),
+        statistics.deviation(),
+        population_.percentile(10)
+    };
+
+    handler(error::success, snapshot);
 }
 
 // regression
@@ -324,6 +339,9 @@ void chaser_check::do_regressed(height_t branch_point) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
+    // Candidates above the branch point have changed.
+    associated_.reset(branch_point);
+
     // Inconsequential regression, work isn't there yet.
     if (branch_point >= position())
         return;
@@ -332,6 +350,8 @@ void chaser_check::do_regressed(height_t branch_point) NOEXCEPT
     set_position(branch_point);
     stop_tracking();
     maps_.clear();
+    issued_.clear();
+    redundant_ = zero;
     notify(error::success, chase::purge, branch_point);
 }
 
@@ -354,6 +374,10 @@ void chaser_check::do_checked(height_t height) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
+    // Tracked from the event, heights above the loaded top load from store.
+    associated_.set(height);
+    set_downloaded(height);
+
     // Candidate block was checked at the given height, advance.
     if (height == add1(position()))
         do_bump(height);
@@ -365,18 +389,8 @@ void chaser_check::do_bump(height_t) NOEXCEPT
     if (purging())
         return;
 
-    const auto& query = archive();
-    auto height = position();
-
-    // TODO: query.is_associated() is expensive (hashmap search).
     // Skip checked blocks starting immediately after last checked.
-    while (!closed() && query.is_associated(
-        query.to_candidate((height = add1(height)))))
-    {
-        set_position(height);
-    }
-
-    do_headers(sub1(height));
+    do_headers(sub1(advance_associated()));
 }
 
 // add headers
@@ -401,33 +415,49 @@ bool chaser_check::purging() const NOEXCEPT
     return !job_;
 }
 
-void chaser_check::get_hashes(map_handler&& handler) NOEXCEPT
+void chaser_check::get_hashes(object_key channel, bool idle,
+    map_handler&& handler) NOEXCEPT
 {
+    // The handler is always invoked, as the channel awaits its completion.
     if (closed())
+    {
+        handler(network::error::service_stopped, empty_map(), {});
         return;
+    }
 
-    POST(do_get_hashes, std::move(handler));
+    POST(do_get_hashes, channel, idle, std::move(handler));
 }
 
-void chaser_check::put_hashes(const map_ptr& map,
+void chaser_check::put_hashes(object_key channel, const map_ptr& map,
     result_handler&& handler) NOEXCEPT
 {
     if (closed())
         return;
 
-    POST(do_put_hashes, map, std::move(handler));
+    POST(do_put_hashes, channel, map, std::move(handler));
 }
 
-void chaser_check::do_get_hashes(const map_handler& handler) NOEXCEPT
+void chaser_check::do_get_hashes(object_key channel, bool idle,
+    const map_handler& handler) NOEXCEPT
 {
     BC_ASSERT(stranded());
-    if (closed() || purging())
+    if (closed())
+    {
+        handler(network::error::service_stopped, empty_map(), {});
+        return;
+    }
+
+    // No work while purging, chase::download is notified upon completion.
+    if (purging())
+    {
+        handler(error::success, empty_map(), {});
         return;
+    }
 
-    handler(error::success, get_map(), job_);
+    handler(error::success, get_map(channel, idle), job_);
 }
 
-void chaser_check::do_put_hashes(const map_ptr& map,
+void chaser_check::do_put_hashes(object_key channel, const map_ptr& map,
     const result_handler& handler) NOEXCEPT
 {
     BC_ASSERT(stranded());
@@ -435,6 +465,7 @@ void chaser_check::do_put_hashes(const map_ptr& map,
     if (closed() || purging())
         return;
 
+    set_returned(channel, map);
     if (set_map(map))
         notify(error::success, chase::download, map->size());
 
@@ -444,10 +475,52 @@ void chaser_check::do_put_hashes(const map_ptr& map,
 // utilities
 // ----------------------------------------------------------------------------
 
-map_ptr chaser_check::get_map() NOEXCEPT
+// Maps are filled in height order from the front of the queue, so that the
+// window drains evenly across channels of differing performance.
+map_ptr chaser_check::get_map(object_key channel, bool idle) NOEXCEPT
 {
     BC_ASSERT(stranded());
-    return maps_.empty() ? empty_map() : pop_front(maps_);
+    const auto map = empty_map();
+    const auto size = get_map_size(channel);
+
+    while (map->size() < size && !maps_.empty())
+    {
+        const auto& front = maps_.front();
+        auto& index = front->get<association::pos>();
+        const auto count = std::min(size - map->size(), front->size());
+        map->merge(index, index.begin(), std::next(index.begin(), count));
+
+        if (front->empty())
+            maps_.pop_front();
+    }
+
+    // Unissued work is exhausted, redundantly request outstanding work.
+    // A channel still holding work is not idle, so it gets no endgame work.
+    if (map->empty())
+        return idle ? get_endgame(channel, size) : map;
+
+    set_issued(channel, map);
+    return map;
+}
+
+// Inventory size scaled by the channel's rate relative to the mean rate.
+size_t chaser_check::get_map_size(object_key channel) const NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    const auto& speeds = population_.speeds();
+    const auto it = speeds.find(channel);
+    if (it == speeds.end() || speeds.size() < minimum_for_standard_deviation)
+        return inventory_;
+
+    const auto mean = population_.speed().mean();
+    if (!(mean > 0.0))
+        return inventory_;
+
+    const auto scaled = std::ceil(to_floating(inventory_) * it->second / mean);
+    const auto size = to_integer<size_t>(std::min(scaled,
+        to_floating(messages::peer::max_inventory)));
+
+    return std::max(size, one);
 }
 
 bool chaser_check::set_map(const map_ptr& map) NOEXCEPT
@@ -472,6 +545,9 @@ size_t chaser_check::set_unassociated() NOEXCEPT
     if (closed() || purging())
         return {};
 
+    // Position is advanced over associated runs (beyond the loaded window).
+    advance_associated();
+
     // Defer new work issuance until gaps filled and validation caught up.
     if (position() < requested_ || advanced_ < requested_)
         return {};
@@ -491,13 +567,31 @@ size_t chaser_check::set_unassociated() NOEXCEPT
     const auto stop = std::min(step, maximum_height_);
     size_t count{};
 
-    while (true)
+    // Unassociated heights are taken from the bitmap, loaded through stop
+    // (each height is queried only once), as opposed to a store scan.
+    // Heights above the candidate top are not loaded, and have no context.
+    const auto top = std::min(stop, query.get_top_candidate());
+    associated_.load(top, [this](size_t value) NOEXCEPT
+    {
+        return is_associated(value);
+    });
+
+    auto height = associated_.to_unassociated(add1(requested_));
+    while (height <= stop)
     {
-        // Calls query.is_associated() per block, expensive (hashmap search).
-        const auto map = std::make_shared<associations>(
-            query.get_unassociated_above(requested_, inventory_, stop));
+        const auto map = empty_map();
+        for (; height <= stop && map->size() < inventory_;
+            height = associated_.to_unassociated(add1(height)))
+        {
+            chain::context context{};
+            const auto link = query.to_candidate(height);
+            if (!query.get_context(context, link))
+                break;
+
+            map->insert({ link, query.get_header_key(link), context });
+        }
 
-        if (!set_map(map))
+        if (map->empty() || !set_map(map))
             break;
 
         requested_ = map->top().height;
@@ -522,15 +616,152 @@ size_t chaser_check::get_inventory_size() const NOEXCEPT
     if (is_zero(peers) || !is_current(false))
         return zero;
 
-    const auto& query = archive();
-    const auto fork = query.get_fork();
-
+    // Counted above position (advanced over the associated run above fork).
     const auto span = ceilinged_multiply(messages::peer::max_inventory, peers);
     const auto step = std::min(maximum_concurrency_, span);
-    const auto inventory = query.get_unassociated_count_above(fork, step);
+    const auto inventory = associated_.count_unassociated(position(), step);
     return ceilinged_divide(inventory, peers);
 }
 
+// endgame
+// ----------------------------------------------------------------------------
+// Once unissued work is exhausted the slowest channels gate do_advanced. Idle
+// channels are issued the lowest outstanding heights of other channels, up to
+// endgame_blocks_ concurrently. Upon download the other holder is cancelled.
+
+void chaser_check::set_issued(object_key channel, const map_ptr& map) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (is_zero(endgame_blocks_))
+        return;
+
+    std::for_each(map->pos_begin(), map->pos_end(),
+        [&](const auto& item) NOEXCEPT
+        {
+            issued_.insert_or_assign(item.context.height,
+                issue{ channel, {}, item });
+        });
+}
+
+void chaser_check::set_returned(object_key channel,
+    const map_ptr& map) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (is_zero(endgame_blocks_))
+        return;
+
+    // Work that remains held by another channel is not requeued.
+    std::vector<hash_digest> held{};
+    std::for_each(map->pos_begin(), map->pos_end(),
+        [&](const auto& item) NOEXCEPT
+        {
+            const auto it = issued_.find(item.context.height);
+            if (it == issued_.end())
+                return;
+
+            if (is_zero(it->second.copy))
+            {
+                issued_.erase(it);
+                return;
+            }
+
+            // The remaining holder becomes (or remains) the sole owner.
+            if (it->second.owner == channel)
+                it->second.owner = it->second.copy;
+
+            it->second.copy = {};
+            held.push_back(item.hash);
+            --redundant_;
+        });
+
+    for (const auto& hash: held)
+        map->erase(map->find(hash));
+}
+
+void chaser_check::set_downloaded(size_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    const auto it = issued_.find(height);
+    if (it == issued_.end())
+        return;
+
+    // Either holder may have won, the other is cancelled (winner ignores).
+    if (const auto copy = it->second.copy; is_nonzero(copy))
+    {
+        notify_one(it->second.owner, error::success, chase::cancel, height);
+        notify_one(copy, error::success, chase::cancel, height);
+        --redundant_;
+    }
+
+    issued_.erase(it);
+}
+
+map_ptr chaser_check::get_endgame(object_key channel, size_t size) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    const auto map = empty_map();
+    if (is_zero(endgame_blocks_))
+        return map;
+
+    // Lowest outstanding heights first, as these gate validation.
+    for (auto& [height, issue]: issued_)
+    {
+        if (redundant_ >= endgame_blocks_ || map->size() >= size)
+            break;
+
+        if (issue.owner == channel || is_nonzero(issue.copy))
+            continue;
+
+        issue.copy = channel;
+        map->insert(issue.item);
+        ++redundant_;
+
+        // Both holders check the store for the block only once shared.
+        notify_one(issue.owner, error::success, chase::shared, height);
+        notify_one(channel, error::success, chase::shared, height);
+    }
+
+    if (!map->empty())
+    {
+        LOGV("Endgame (" << map->size() << ") redundant (" << redundant_
+            << ") outstanding (" << issued_.size() << ").");
+    }
+
+    return map;
+}
+
+// association bitmap
+// ----------------------------------------------------------------------------
+// Loaded heights extend only to the concurrency window above the associated
+// run, so a long run (e.g. at restart near tip) is crossed one window at a
+// time until an unassociated candidate is found or the candidate top passed.
+
+size_t chaser_check::advance_associated() NOEXCEPT
+{
+    // Called from start.
+    ////BC_ASSERT(stranded());
+    const auto& query = archive();
+
+    // Each candidate height is queried once, subsequently tracked by event.
+    const auto height = associated_.advance(position(), maximum_concurrency_,
+        query.get_top_candidate(), [this](size_t value) NOEXCEPT
+        {
+            return is_associated(value);
+        });
+
+    if (height > add1(position()))
+        set_position(sub1(height));
+
+    return height;
+}
+
+// Loading is abandoned (unset) once closed, as there is no further use.
+bool chaser_check::is_associated(size_t height) const NOEXCEPT
+{
+    const auto& query = archive();
+    return !closed() && query.is_associated(query.to_candidate(height));
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
@@ -18,7 +18,14 @@
  */
 #include <bitcoin/node/chasers/chaser_confirm.hpp>
 
+#include <algorithm>
+#if defined(HAVE_EXECUTION)
+#include <execution>
+#endif
+#include <iterator>
 #include <ranges>
+#include <unordered_map>
+#include <vector>
 #include <bitcoin/node/chasers/chaser.hpp>
 #include <bitcoin/node/define.hpp>
 #include <bitcoin/node/full_node.hpp>
@@ -35,6 +42,8 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
 chaser_confirm::chaser_confirm(full_node& node) NOEXCEPT
   : chaser(node),
+    confirm_batch_(node.config().node.confirm_batch),
+    confirm_window_(node.config().node.confirm_window),
     filter_(node.archive().filter_enabled())
 {
 }
@@ -43,6 +52,8 @@ code chaser_confirm::start() NOEXCEPT
 {
     const auto& query = archive();
     set_position(query.get_fork());
+    fork_point_ = position();
+    validated_ = position();
 
     if (is_current(true))
     {
@@ -59,14 +70,20 @@ bool chaser_confirm::handle_event(const code&, chase event_,
     if (closed())
         return false;
 
-    // Stop generating query during suspension.
-    if (suspended())
+    // Stop generating query during suspension, but continue to track
+    // validation, as a dropped validation would leave a gap in validated.
+    if (suspended() && event_ != chase::valid && event_ != chase::regressed &&
+        event_ != chase::disorganized)
         return true;
 
     switch (event_)
     {
         case chase::resume:
         case chase::start:
+        {
+            POST(do_resync, height_t{});
+            break;
+        }
         case chase::bump:
         {
             POST(do_bump, height_t{});
@@ -102,15 +119,56 @@ bool chaser_confirm::handle_event(const code&, chase event_,
 
 // Track validation
 // ----------------------------------------------------------------------------
+// The validated fork (candidate states above the fork point) is maintained
+// from validation events, so that confirmation does not walk the candidate
+// chain from the fork point on each event. The store resyncs it at start, on
+// resume, and after a fork fails to organize.
 
-void chaser_confirm::do_regressed(height_t) NOEXCEPT
+void chaser_confirm::do_regressed(height_t branch_point) NOEXCEPT
 {
     BC_ASSERT(stranded());
+
+    // Validations above the branch point are of former candidates.
+    pending_.erase(pending_.upper_bound(branch_point), pending_.end());
+
+    // Candidates of the new branch are revalidated (announced) from here.
+    if (branch_point < fork_point_)
+    {
+        fork_.clear();
+        fork_point_ = branch_point;
+    }
+    else if (branch_point < validated_)
+    {
+        fork_.resize(branch_point - fork_point_);
+    }
+
+    validated_ = fork_point_ + fork_.size();
+    worked_ = zero;
+    do_bumped({});
 }
 
-void chaser_confirm::do_validated(height_t) NOEXCEPT
+// Validations arrive out of order, and those above a gap in validated heights
+// cannot extend the validated fork, so these are held until the gap fills.
+void chaser_confirm::do_validated(height_t height) NOEXCEPT
 {
     BC_ASSERT(stranded());
+
+    if (height > add1(validated_))
+    {
+        pending_.insert(height);
+        return;
+    }
+
+    if (height == add1(validated_))
+    {
+        auto top = height;
+        while (is_nonzero(pending_.erase(add1(top))))
+            ++top;
+
+        if (!extend_fork(top))
+            resync_ = true;
+    }
+
     do_bumped({});
 }
 
@@ -120,40 +178,91 @@ void chaser_confirm::do_bump(height_t) NOEXCEPT
     do_bumped({});
 }
 
+void chaser_confirm::do_resync(height_t) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    resync_ = true;
+    do_bumped({});
+}
+
+// Append states of validated candidates through height to the fork. State is
+// classified as by the store, bypass (checkpoint or milestone) unless already
+// confirmable. False if a candidate is not in a confirmable state.
+bool chaser_confirm::extend_fork(height_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    const auto& query = archive();
+
+    while (validated_ < height)
+    {
+        const auto next = add1(validated_);
+        const auto link = query.to_candidate(next);
+        auto ec = query.get_block_state(link);
+
+        if (ec == database::error::unvalidated ||
+            ec == database::error::block_valid)
+        {
+            if (is_under_checkpoint(next) || query.is_milestone(link))
+                ec = database::error::bypassed;
+        }
+
+        if (ec != database::error::bypassed &&
+            ec != database::error::block_valid &&
+            ec != database::error::block_confirmable)
+            return false;
+
+        fork_.push_back({ link, ec });
+        validated_ = next;
+    }
+
+    return true;
+}
+
+// The store is authoritative for the validated fork (events may be missed).
+void chaser_confirm::resync_fork() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // Guarded by candidate interlock.
+    fork_ = archive().get_validated_fork(fork_point_, checkpoint(), filter_);
+    validated_ = fork_point_ + fork_.size();
+    pending_.erase(pending_.begin(), pending_.upper_bound(validated_));
+    resync_ = false;
+}
+
 // Confirm (not cancellable)
 // ----------------------------------------------------------------------------
 
-// Compute relative work, set fork and fork_point, and invoke reorganize.
+// Compare relative work of the validated fork, and invoke reorganize.
 void chaser_confirm::do_bumped(height_t) NOEXCEPT
 {
     BC_ASSERT(stranded());
     const auto& query = archive();
 
-    if (closed())
+    if (closed() || suspended())
         return;
 
-    // Guarded by candidate interlock.
-    size_t fork_point{};
-    auto fork = query.get_validated_fork(fork_point, checkpoint(), filter_);
+    if (resync_)
+        resync_fork();
 
     // Fork may be empty if candidates were reorganized.
-    if (fork.empty())
+    if (fork_.empty())
         return;
 
     // Cannot be forking above top.
     const auto top = query.get_top_confirmed();
-    if (fork_point > top)
+    if (fork_point_ > top)
     {
         fault(error::confirm1);
         return;
     }
 
     // Compare work if fork is below top.
-    if (fork_point < top)
+    if (fork_point_ < top)
     {
         // Gets work of candidate branch (above fork point).
         uint256_t work{};
-        if (!query.get_work(work, fork))
+        if (!get_work(work, fork_, fork_point_))
         {
             fault(error::confirm2);
             return;
@@ -161,7 +270,7 @@ void chaser_confirm::do_bumped(height_t) NOEXCEPT
 
         // Compares candidate branch work to confirmed (above fork point).
         bool strong{};
-        if (!query.get_strong_fork(strong, work, fork_point))
+        if (!query.get_strong_fork(strong, work, fork_point_))
         {
             fault(error::confirm3);
             return;
@@ -173,7 +282,56 @@ void chaser_confirm::do_bumped(height_t) NOEXCEPT
             return;
     }
 
-    reorganize(fork, top, fork_point);
+    reorganize(fork_, top, fork_point_);
+
+    // An organized fork is consumed, otherwise a block failed to confirm (and
+    // the confirmed chain was restored), so resync from the store.
+    const auto fork_top = fork_point_ + fork_.size();
+    if (query.to_confirmed(fork_top) == fork_.back().link)
+    {
+        fork_.clear();
+        fork_point_ = fork_top;
+    }
+    else
+    {
+        resync_ = true;
+    }
+}
+
+// Work of the validated fork is accumulated as the fork extends, so that
+// only work of blocks added since the previous comparison is queried.
+bool chaser_confirm::get_work(uint256_t& work, const header_states& fork,
+    size_t fork_point) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    const auto extends = (fork_point == worked_point_) &&
+        is_nonzero(worked_) && (worked_ <= fork.size()) &&
+        (fork.at(sub1(worked_)).link == worked_link_);
+
+    if (!extends)
+    {
+        work_ = zero;
+        worked_ = zero;
+        worked_point_ = fork_point;
+    }
+
+    if (worked_ < fork.size())
+    {
+        uint256_t added{};
+        const header_states suffix(std::next(fork.begin(), worked_),
+            fork.end());
+
+        if (!archive().get_work(added, suffix))
+            return false;
+
+        work_ += added;
+        worked_ = fork.size();
+        worked_link_ = fork.back().link;
+    }
+
+    work = work_;
+    return true;
 }
 
 // Pop confirmed chain from top down to above fork point, save popped.
@@ -215,9 +373,14 @@ void chaser_confirm::organize(header_states& fork, const header_links& popped,
     BC_ASSERT(stranded());
     auto& query = archive();
     auto height = add1(fork_point);
+    auto sequential = zero;
 
-    for (const auto& state: fork)
+    // Notifications are coalesced while catching up.
+    batching_ = is_nonzero(confirm_batch_) && !is_current(true);
+
+    for (auto index = zero; index < fork.size(); ++index)
     {
+        const auto& state = fork.at(index);
         switch (state.ec.value())
         {
             case database::error::bypassed:
@@ -233,6 +396,27 @@ void chaser_confirm::organize(header_states& fork, const header_links& popped,
             }
             case database::error::block_valid:
             {
+                if (is_nonzero(confirm_window_) && is_zero(sequential))
+                {
+                    size_t count{}, run{};
+                    if (!confirm_window(count, run, fork, index, height))
+                        return;
+
+                    // Window blocks are confirmed and organized.
+                    if (is_nonzero(count))
+                    {
+                        index += sub1(count);
+                        height += count;
+                        continue;
+                    }
+
+                    // The run confirms in sequence, then windows resume.
+                    sequential = run;
+                }
+
+                if (is_nonzero(sequential))
+                    --sequential;
+
                 if (!confirm_block(state.link, height, popped, fork_point))
                     return;
 
@@ -262,6 +446,10 @@ void chaser_confirm::organize(header_states& fork, const header_links& popped,
         }
     }
 
+    flush_organized();
+    batching_ = false;
+    worked_ = zero;
+
     // Prevent stall by posting internal event, avoiding external handlers.
     // Posts new work, preventing recursion and releasing reorganization lock.
     handle_event(error::success, chase::bump, height_t{});
@@ -312,6 +500,108 @@ bool chaser_confirm::confirm_block(const header_link& link,
     return complete_block(error::success, link, height, false);
 }
 
+// Confirm a run of valid blocks from fork[start], with confirmability of the
+// run computed in parallel. Confirmability depends on the strong set, so the
+// run is tentatively set strong, making spends of outputs of its lower blocks
+// confirmable. A block that spends an output of a higher block of the run is
+// not confirmable in sequence, so the run ends below the first such block.
+// The run is then confirmable in sequence up to its first unconfirmable block
+// (extra strong blocks above can only cause conflict). Blocks from that one up
+// are set unstrong and confirm in sequence. The confirmed index is pushed only
+// after set_block_confirmable, as in sequence. Count is the number of blocks
+// confirmed and organized, run is the number considered (false is fault).
+bool chaser_confirm::confirm_window(size_t& count, size_t& run,
+    const header_states& fork, size_t start, size_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    auto& query = archive();
+    count = zero;
+
+    header_links links{};
+    for (auto index = start; index < fork.size() &&
+        links.size() < confirm_window_; ++index)
+    {
+        const auto& state = fork.at(index);
+        if (state.ec.value() != database::error::block_valid)
+            break;
+
+        links.push_back(state.link);
+    }
+
+    run = links.size();
+    if (run < two)
+        return true;
+
+    if (const auto ec = confirm_run(count, query, links))
+    {
+        fault(ec);
+        return false;
+    }
+
+    for (auto index = zero; index < count; ++index)
+    {
+        const auto& link = links.at(index);
+
+        // Before set_block_confirmable.
+        if (!query.set_filter_head(link))
+        {
+            fault(error::confirm12);
+            return false;
+        }
+
+        if (!query.set_block_confirmable(link))
+        {
+            fault(error::confirm13);
+            return false;
+        }
+
+        complete_block(error::success, link, height + index, false);
+
+        // After set_block_confirmable (strong is already set).
+        if (!query.push_confirmed(link, false))
+        {
+            fault(error::confirm8);
+            return false;
+        }
+
+        organized(link, height + index);
+    }
+
+    LOGV("Confirmed (" << count << ") of (" << run << ") blocks in "
+        "parallel from [" << height << "].");
+
+    return true;
+}
+
+// static
+// Tentatively set strong the leading independent blocks of links (truncated
+// to them), and count the leading confirmable blocks of the run. Blocks from
+// the first unconfirmable are reverted for sequential confirm. A run of less
+// than two independent blocks is not set strong (zero count).
+code chaser_confirm::confirm_run(size_t& count, query& query,
+    database::header_links& links) NOEXCEPT
+{
+    count = zero;
+    links.resize(independent(query, links));
+    if (links.size() < two)
+        return error::success;
+
+    // Tentatively strong (not confirmed), as the run is not yet confirmable.
+    for (const auto& link: links)
+        if (!query.set_strong(link))
+            return error::confirm14;
+
+    const auto results = confirmable(query, links);
+    while (count < links.size() && !results.at(count))
+        ++count;
+
+    for (auto index = count; index < links.size(); ++index)
+        if (!query.set_unstrong(links.at(index)))
+            return error::confirm15;
+
+    return error::success;
+}
+
 // Confirmation complete, not yet organized.
 bool chaser_confirm::complete_block(const code& ec, const header_link& link,
     size_t height, bool bypass) NOEXCEPT
@@ -320,6 +610,10 @@ bool chaser_confirm::complete_block(const code& ec, const header_link& link,
 
     if (ec)
     {
+        // Subscribers observe confirmation in order.
+        flush_organized();
+        batching_ = false;
+
         // Database errors are fatal.
         if (database::error::error_category::contains(ec))
         {
@@ -336,7 +630,9 @@ bool chaser_confirm::complete_block(const code& ec, const header_link& link,
     }
 
     // CONFIRMABLE BLOCK
-    notify(error::success, chase::confirmable, height);
+    if (!batching_)
+        notify(error::success, chase::confirmable, height);
+
     fire(events::block_confirmed, height);
     LOGV("Block confirmable: " << height << (bypass ? " (bypass)" : ""));
     return true;
@@ -351,6 +647,9 @@ bool chaser_confirm::set_reorganized(const header_link& link,
 {
     BC_ASSERT(stranded());
     BC_ASSERT(!is_under_checkpoint(confirmed_height));
+
+    // Subscribers observe organization before reorganization.
+    flush_organized();
     if (!archive().pop_confirmed())
         return false;
 
@@ -387,12 +686,110 @@ bool chaser_confirm::set_organized(const header_link& link,
     if (!query.push_confirmed(link, !is_under_checkpoint(confirmed_height)))
         return false;
 
-    notify(error::success, chase::organized, link);
+    organized(link, confirmed_height);
+    return true;
+}
+
+void chaser_confirm::organized(const header_link& link,
+    height_t confirmed_height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (batching_)
+    {
+        organized_top_ = confirmed_height;
+        if (++organized_ == confirm_batch_)
+            flush_organized();
+    }
+    else
+    {
+        notify(error::success, chase::organized, link);
+    }
+
     fire(events::block_organized, confirmed_height);
     LOGV("Block organized: " << confirmed_height);
 
     announce(link, confirmed_height);
-    return true;
+}
+
+// Notify the confirmed range in place of per block confirmable/organized.
+void chaser_confirm::flush_organized() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (is_zero(organized_))
+        return;
+
+    notify(error::success, chase::confirmed, organized_top_);
+    LOGV("Blocks confirmed (" << organized_ << ") through: "
+        << organized_top_);
+
+    organized_ = zero;
+}
+
+// static
+// Block confirmability is computed concurrently (store reads only).
+chaser_confirm::codes chaser_confirm::confirmable(const query& query,
+    const database::header_links& links) NOEXCEPT
+{
+    codes results(links.size());
+    const auto confirm = [&query](const auto& link) NOEXCEPT
+    {
+        return query.block_confirmable(link);
+    };
+
+#if defined(HAVE_EXECUTION)
+    std::transform(std::execution::par, links.begin(), links.end(),
+        results.begin(), confirm);
+#else
+    std::transform(links.begin(), links.end(), results.begin(), confirm);
+#endif
+
+    return results;
+}
+
+// Number of leading blocks of the run that do not spend an output created by
+// a higher block of the run (blocks are read concurrently, store reads only).
+size_t chaser_confirm::independent(const query& query,
+    const database::header_links& links) NOEXCEPT
+{
+    std::vector<chain::block::cptr> blocks(links.size());
+    const auto get = [&query](const auto& link) NOEXCEPT
+    {
+        return query.get_block(link, false);
+    };
+
+#if defined(HAVE_EXECUTION)
+    std::transform(std::execution::par, links.begin(), links.end(),
+        blocks.begin(), get);
+#else
+    std::transform(links.begin(), links.end(), blocks.begin(), get);
+#endif
+
+    std::unordered_map<hash_digest, size_t> created{};
+    for (auto index = zero; index < blocks.size(); ++index)
+    {
+        if (!blocks.at(index))
+            return index;
+
+        for (const auto& tx: *blocks.at(index)->transactions_ptr())
+            created.emplace(tx->hash(false), index);
+    }
+
+    for (auto index = zero; index < blocks.size(); ++index)
+    {
+        const auto& txs = *blocks.at(index)->transactions_ptr();
+        for (auto tx = std::next(txs.begin()); tx != txs.end(); ++tx)
+        {
+            for (const auto& input: *(*tx)->inputs_ptr())
+            {
+                const auto it = created.find(input->point().hash());
+                if (it != created.end() && it->second > index)
+                    return index;
+            }
+        }
+    }
+
+    return blocks.size();
 }
 
 // Rollback to the fork point, then forward through previously popped.
@@ -18,10 +18,15 @@
  */
 #include <bitcoin/node/chasers/chaser_validate.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <iterator>
+#include <mutex>
 #include <bitcoin/node/chasers/chaser.hpp>
 #include <bitcoin/node/define.hpp>
 #include <bitcoin/node/full_node.hpp>
+#include <bitcoin/node/validation_backlog.hpp>
 
 namespace libbitcoin {
 namespace node {
@@ -39,10 +44,20 @@ chaser_validate::chaser_validate(full_node& node) NOEXCEPT
   : chaser(node),
     threadpool_(node.config().node.threads_(),
         node.config().node.thread_priority_()),
+    populator_(node.config().node.populate_threads,
+        node.config().node.thread_priority_()),
     independent_strand_(threadpool_.service().get_executor()),
+    prefetch_strand_(is_zero(node.config().node.populate_threads) ?
+        threadpool_.service().get_executor() :
+        populator_.service().get_executor()),
     subsidy_interval_(node.config().bitcoin.subsidy_interval_blocks),
     initial_subsidy_(node.config().bitcoin.initial_subsidy()),
-    maximum_backlog_(node.config().node.maximum_concurrency_()),
+    backlog_limit_(node.config().node.threads_(),
+        node.config().node.maximum_concurrency_(),
+        node.config().node.backlog_bytes),
+    threads_(node.config().node.threads_()),
+    prefetch_blocks_(node.config().node.prefetch_blocks),
+    populate_threads_(node.config().node.populate_threads),
     node_witness_(node.config().network.witness_node()),
     filter_(node.archive().filter_enabled())
 {
@@ -115,6 +130,13 @@ void chaser_validate::do_regressed(height_t branch_point) NOEXCEPT
     if (branch_point >= position())
         return;
 
+    // Prefetched blocks above the branch point are no longer candidates.
+    {
+        std::unique_lock lock(prefetch_mutex_);
+        prefetch_.clear();
+    }
+
+    prefetched_ = branch_point;
     set_position(branch_point);
 }
 
@@ -159,7 +181,7 @@ void chaser_validate::do_bumped(height_t height) NOEXCEPT
     const auto& query = archive();
 
     // Bypass until next event if validation backlog is full.
-    while ((backlog_ < maximum_backlog_) && !closed() && !suspended())
+    while (!is_throttled() && !closed() && !suspended())
     {
         const auto link = query.to_candidate(height);
         const auto ec = query.get_block_state(link);
@@ -176,7 +198,7 @@ void chaser_validate::do_bumped(height_t height) NOEXCEPT
         {
             if (filter_)
             {
-                post_block(link, bypass);
+                post_block(link, height, bypass);
             }
             else
             {
@@ -187,13 +209,13 @@ void chaser_validate::do_bumped(height_t height) NOEXCEPT
         {
             case database::error::unvalidated:
             {
-                post_block(link, bypass);
+                post_block(link, height, bypass);
                 break;
             }
             case database::error::block_valid:
             {
                 if (query.is_prevouts_cached(link))
-                    post_block(link, true);
+                    post_block(link, height, true);
                 else
                     complete_block(error::success, link, height, true);
                 break;
@@ -218,60 +240,267 @@ void chaser_validate::do_bumped(height_t height) NOEXCEPT
         // All posted validations must complete or this is invalid.
         // So posted validations continue despite network suspension.
         set_position(height++);
+        post_prefetch(height);
+    }
+}
+
+// Read ahead of validation, so that validation threads rarely fault on the
+// store memory map. Reads are sequential on a strand of the store read
+// (populate) threadpool if enabled, so read-ahead occupies at most one
+// validation thread otherwise. Blocks are held only in the window above
+// position, as post_block takes each as it is posted, so that none is retained
+// once validation has passed it (and none is awaited, see post_block).
+void chaser_validate::post_prefetch(size_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (is_zero(prefetch_blocks_))
+        return;
+
+    const auto& query = archive();
+    const auto top = ceilinged_add(height, prefetch_blocks_);
+
+    // Evict blocks at or below position that were not posted (or taken).
+    {
+        std::unique_lock lock(prefetch_mutex_);
+        prefetch_.erase(prefetch_.begin(), prefetch_.upper_bound(position()));
+    }
+
+    for (auto next = std::max(height, add1(prefetched_)); next < top; ++next)
+    {
+        const auto link = query.to_candidate(next);
+        if (!query.is_associated(link))
+            return;
+
+        // Only blocks that do_bumped will post for validation are read.
+        prefetched_ = next;
+        const auto bypass = is_under_checkpoint(next) ||
+            query.is_milestone(link);
+
+        // Bypassed blocks are read only to compute filters.
+        auto posted = filter_;
+        if (!bypass)
+        {
+            const auto ec = query.get_block_state(link);
+            posted = (ec == database::error::unvalidated) ||
+                (ec == database::error::block_valid &&
+                    query.is_prevouts_cached(link));
+        }
+
+        if (!posted)
+            continue;
+
+        {
+            std::unique_lock lock(prefetch_mutex_);
+            prefetch_.emplace(next, prefetched{ link, nullptr });
+        }
+
+        boost::asio::post(prefetch_strand_, BIND(prefetch_block, link, next));
+    }
+}
+
+void chaser_validate::prefetch_block(const header_link& link,
+    size_t height) NOEXCEPT
+{
+    if (closed())
+        return;
+
+    // Validation has already taken (or evicted or regressed) the block.
+    const auto pending = [&]() NOEXCEPT
+    {
+        const auto it = prefetch_.find(height);
+        return it != prefetch_.end() && it->second.link == link ?
+            it : prefetch_.end();
+    };
+
+    {
+        std::unique_lock lock(prefetch_mutex_);
+        if (pending() == prefetch_.end())
+            return;
     }
+
+    const auto block = archive().get_block(link, node_witness_);
+
+    std::unique_lock lock(prefetch_mutex_);
+    const auto it = pending();
+    if (it != prefetch_.end())
+        it->second.block = block;
 }
 
-void chaser_validate::post_block(const header_link& link,
+void chaser_validate::post_block(const header_link& link, size_t height,
     bool bypass) NOEXCEPT
 {
     BC_ASSERT(stranded());
     backlog_.fetch_add(one, std::memory_order_relaxed);
-    PARALLEL(validate_block, link, bypass);
+    if (!bypass)
+        backlog_limit_.queue();
+
+    // A prefetched block is taken, one still being read is read directly.
+    chain::block::cptr block{};
+    if (is_nonzero(prefetch_blocks_))
+    {
+        std::unique_lock lock(prefetch_mutex_);
+        const auto it = prefetch_.find(height);
+        if (it != prefetch_.end())
+        {
+            if (it->second.link == link)
+                block = it->second.block;
+
+            prefetch_.erase(it);
+        }
+    }
+
+    // Store reads (populate) are optionally isolated from script validation.
+    if (is_zero(populate_threads_))
+    {
+        PARALLEL(validate_block, link, bypass, block);
+    }
+    else
+    {
+        boost::asio::post(populator_.service(),
+            BIND(validate_block, link, bypass, block));
+    }
 }
 
 // Unstranded (concurrent by block)
 // ----------------------------------------------------------------------------
 
 void chaser_validate::validate_block(const header_link& link,
-    bool bypass) NOEXCEPT
+    bool bypass, const chain::block::cptr& block) NOEXCEPT
 {
     if (closed())
         return;
 
     code ec{};
-    chain::context ctx{};
     auto& query = archive();
+    populated item{ {}, link, {}, std::chrono::steady_clock::now(), zero,
+        bypass };
 
-    // TODO: implement allocator parameter resulting in full allocation to
-    // shared_ptr<block>, to optimize deallocate (12% of milestone/filter).
-    const auto block = query.get_block(link, node_witness_);
+    // Bypassed blocks are not measured, as they would understate cost.
+    // A block not obtained is measured at zero bytes (excluded from cost).
+    item.block = block ? block : get_block(link);
+    if (!bypass)
+    {
+        backlog_limit_.dequeue();
+        item.bytes = item.block ? item.block->serialized_size(node_witness_) :
+            zero;
+        backlog_limit_.started(item.bytes);
+    }
 
-    if (!block)
+    if (!item.block)
     {
         ec = error::validate2;
     }
-    else if (!query.get_context(ctx, link))
+    else if (!query.get_context(item.ctx, link))
     {
         ec = error::validate3;
     }
-    else if ((ec = populate(bypass, *block, ctx)))
+    else if ((ec = populate(bypass, *item.block, item.ctx)))
     {
         if (!query.set_block_unconfirmable(link))
             ec = error::validate4;
     }
-    else if ((ec = validate(bypass, *block, link, ctx)))
+
+    // Populated blocks are handed to the validation threadpool.
+    if (!ec && is_nonzero(populate_threads_))
     {
-        if (!query.set_block_unconfirmable(link))
+        if (!bypass)
+            backlog_limit_.queue();
+
+        PARALLEL(connect_block, ec, item);
+        return;
+    }
+
+    connect_block(ec, item);
+}
+
+void chaser_validate::connect_block(code ec,
+    const populated& item) NOEXCEPT
+{
+    if (closed())
+        return;
+
+    // Only a successfully populated block is posted here (from populator).
+    if (!ec && !item.bypass && is_nonzero(populate_threads_))
+        backlog_limit_.dequeue();
+
+    const auto& link = item.link;
+    if (!ec && (ec = validate(item.bypass, *item.block, link, item.ctx)))
+    {
+        if (!archive().set_block_unconfirmable(link))
             ec = error::validate5;
     }
 
-    complete_block(ec, link, ctx.height, bypass);
+    complete_block(ec, link, item.ctx.height, item.bypass);
+
+    if (!item.bypass)
+    {
+        using namespace std::chrono;
+        const auto span = duration_cast<microseconds>(steady_clock::now() -
+            item.start).count();
+        report(backlog_limit_.completed(item.bytes,
+            sign_cast<uint64_t>(span)));
+    }
 
     // Prevent stall by posting internal event, avoiding external handlers.
-    if (is_one(backlog_.fetch_sub(one, std::memory_order_relaxed)))
+    // Resume once the backlog crosses back below its (adaptive) limit, rather
+    // than upon drain, so that validation threads are not idled between
+    // rounds. Only the completion that clears throttled_ posts the bump.
+    const auto backlog = backlog_.fetch_sub(one);
+    if (sub1(backlog) < backlog_limit_.limit() && throttled_.exchange(false))
         handle_event(error::success, chase::bump, height_t{});
 }
 
+// Validation backlog is adapted to validation cost and outstanding bytes.
+void chaser_validate::report(validation_backlog::bound bound) NOEXCEPT
+{
+    const auto limit = backlog_limit_.limit();
+
+    switch (bound)
+    {
+        case validation_backlog::bound::cpu:
+            fire(events::backlog_cpu_bound, limit);
+            break;
+        case validation_backlog::bound::store:
+            fire(events::backlog_store_bound, limit);
+            LOGV("Validation backlog reduced to (" << limit << ") store.");
+            break;
+        case validation_backlog::bound::memory:
+            fire(events::backlog_memory_bound, limit);
+            LOGV("Validation backlog reduced to (" << limit << ") memory.");
+            break;
+        case validation_backlog::bound::none:
+        default:
+            break;
+    }
+}
+
+// Validation stops (throttled) with a full backlog, until connect_block
+// observes the backlog below the limit. The flag is set before the backlog is
+// tested again, so a completion that crosses concurrently is not missed. The
+// limit may rise or fall concurrently, which only delays resumption until
+// the next completion.
+bool chaser_validate::is_throttled() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (backlog_ < backlog_limit_.limit())
+        return false;
+
+    throttled_.store(true);
+    if (backlog_ >= backlog_limit_.limit())
+        return true;
+
+    throttled_.store(false);
+    return false;
+}
+
+chain::block::cptr chaser_validate::get_block(
+    const header_link& link) const NOEXCEPT
+{
+    // TODO: implement allocator parameter resulting in full allocation to
+    // shared_ptr<block>, to optimize deallocate (12% of milestone/filter).
+    return archive().get_block(link, node_witness_);
+}
+
 code chaser_validate::populate(bool bypass, const chain::block& block,
     const chain::context& ctx) NOEXCEPT
 {
@@ -309,7 +538,7 @@ code chaser_validate::validate(bool bypass, const chain::block& block,
         if ((ec = block.accept(ctx, subsidy_interval_, initial_subsidy_)))
             return ec;
 
-        if ((ec = block.connect(ctx)))
+        if ((ec = connect(block, ctx)))
             return ec;
 
         if (!query.set_prevouts(link, block))
@@ -326,6 +555,74 @@ code chaser_validate::validate(bool bypass, const chain::block& block,
     return error::success;
 }
 
+// Scripts of large blocks are connected across idle validation threads.
+// Input scripts dominate connect cost, so fan-out (post and wait) is incurred
+// only for blocks of enough inputs (tens of milliseconds) to amortize it.
+code chaser_validate::connect(const chain::block& block,
+    const chain::context& ctx) NOEXCEPT
+{
+    const auto& txs = *block.transactions_ptr();
+    const auto ranges = ceilinged_divide(sub1(txs.size()), connect_range);
+    if (is_one(threads_) || ranges < two ||
+        !is_parallel(txs, minimum_parallel_inputs))
+    {
+        return block.connect(ctx);
+    }
+
+    // Block-level checks of block.connect(), which otherwise only connects
+    // each (non-coinbase) transaction, as is done here in parallel ranges.
+    if (const auto ec = connect_limits(block, ctx))
+        return ec;
+
+    // Helpers may run after the block is released, so txs are owned.
+    const auto connector = std::make_shared<range_connector>(one, txs.size(),
+        connect_range, [txs = block.transactions_ptr(), ctx](
+            size_t index) NOEXCEPT
+        {
+            return txs->at(index)->connect(ctx);
+        });
+
+    // Helpers that start once all ranges are claimed return immediately.
+    for (auto helper = one; helper < std::min(threads_, ranges); ++helper)
+        PARALLEL(connect_ranges, connector);
+
+    // This thread claims ranges until exhausted, then awaits claimed ranges.
+    connector->run();
+    return connector->wait();
+}
+
+void chaser_validate::connect_ranges(
+    const range_connector::ptr& connector) NOEXCEPT
+{
+    connector->run();
+}
+
+// static
+code chaser_validate::connect_limits(const chain::block& block,
+    const chain::context& ctx) NOEXCEPT
+{
+    const auto bip16 = ctx.is_enabled(chain::flags::bip16_rule);
+    const auto bip141 = ctx.is_enabled(chain::flags::bip141_rule);
+    const auto limit = bip141 ? chain::max_fast_sigops :
+        chain::max_block_sigops;
+
+    return block.signature_operations(bip16, bip141) > limit ?
+        system::error::block_sigop_limit : system::error::success;
+}
+
+// static
+bool chaser_validate::is_parallel(const chain::transaction_cptrs& txs,
+    size_t minimum) NOEXCEPT
+{
+    // Coinbase is not connected, stops counting once minimum is reached.
+    size_t inputs{};
+    for (auto tx = std::next(txs.begin()); tx != txs.end(); ++tx)
+        if ((inputs += (*tx)->inputs_ptr()->size()) >= minimum)
+            return true;
+
+    return false;
+}
+
 // May be either concurrent or stranded.
 void chaser_validate::complete_block(const code& ec, const header_link& link,
     size_t height, bool bypass) NOEXCEPT
@@ -359,13 +656,14 @@ void chaser_validate::complete_block(const code& ec, const header_link& link,
 void chaser_validate::stopping(const code& ec) NOEXCEPT
 {
     // Stop threadpool keep-alive, all work must self-terminate to affect join.
+    populator_.stop();
     threadpool_.stop();
     chaser::stopping(ec);
 }
 
 void chaser_validate::stop() NOEXCEPT
 {
-    if (!threadpool_.join())
+    if (!populator_.join() || !threadpool_.join())
     {
         BC_ASSERT_MSG(false, "failed to join threadpool");
         std::abort();
@@ -18,6 +18,7 @@
  */
 #include <bitcoin/node/full_node.hpp>
 
+#include <cstdlib>
 #include <utility>
 #include <bitcoin/node/chasers/chasers.hpp>
 #include <bitcoin/node/define.hpp>
@@ -38,7 +39,10 @@ full_node::full_node(query& query, const configuration& configuration,
     const logger& log) NOEXCEPT
   : net(configuration.network, log),
     config_(configuration),
-    memory_(config_.node.allocation_multiple, config_.network.threads),
+    memory_(config_.node.allocation_multiple, config_.network.threads,
+        config_.node.allocation_retention, config_.node.allocation_mapping,
+        config_.node.allocation_adaptive),
+    checker_(config_.node.check_threads, config_.node.thread_priority_()),
     query_(query),
     chaser_block_(*this),
     chaser_header_(*this),
@@ -228,6 +232,13 @@ void full_node::close() NOEXCEPT
     // Base (net) invokes do_close().
     net::close();
 
+    // Block on check threadpool join (pending checks complete).
+    if (!checker_.join())
+    {
+        BC_ASSERT_MSG(false, "failed to join threadpool");
+        std::abort();
+    }
+
     // Block on chaser stop (including dedicated threadpool joins).
     chaser_header_.stop();
     chaser_block_.stop();
@@ -256,6 +267,9 @@ void full_node::do_close() NOEXCEPT
     chaser_snapshot_.stopping(network::error::service_stopped);
     chaser_storage_.stopping(network::error::service_stopped);
 
+    // Stop check threadpool keep-alive, pending checks self-terminate.
+    checker_.stop();
+
     event_subscriber_.stop(network::error::service_stopped, chase::stop, {});
     net::do_close();
 }
@@ -275,15 +289,16 @@ void full_node::organize(const system::chain::block::cptr& block,
     chaser_block_.organize(block, std::move(handler));
 }
 
-void full_node::get_hashes(map_handler&& handler) NOEXCEPT
+void full_node::get_hashes(object_key channel, bool idle,
+    map_handler&& handler) NOEXCEPT
 {
-    chaser_check_.get_hashes(std::move(handler));
+    chaser_check_.get_hashes(channel, idle, std::move(handler));
 }
 
-void full_node::put_hashes(const map_ptr& map,
+void full_node::put_hashes(object_key channel, const map_ptr& map,
     result_handler&& handler) NOEXCEPT
 {
-    chaser_check_.put_hashes(map, std::move(handler));
+    chaser_check_.put_hashes(channel, map, std::move(handler));
 }
 
 // Events.
@@ -508,9 +523,14 @@ bool full_node::is_recent() const NOEXCEPT
 
 // ----------------------------------------------------------------------------
 void full_node::performance(object_key key, uint64_t speed,
-    result_handler&& handler) NOEXCEPT
+    uint64_t latency, result_handler&& handler) NOEXCEPT
+{
+    chaser_check_.update(key, speed, latency, std::move(handler));
+}
+
+void full_node::get_rates(chaser_check::rates_handler&& handler) NOEXCEPT
 {
-    chaser_check_.update(key, speed, std::move(handler));
+    chaser_check_.get_rates(std::move(handler));
 }
 
 network::memory& full_node::get_memory() NOEXCEPT
@@ -518,6 +538,74 @@ network::memory& full_node::get_memory() NOEXCEPT
     return memory_;
 }
 
+// In-flight checks are capped across channels at the thread count, so that
+// checks never queue behind those of other channels. When at the cap the
+// channel checks inline on its own strand, which holds off its next read.
+bool full_node::post_check(work_handler&& work) NOEXCEPT
+{
+    const size_t limit = config_.node.check_threads;
+    auto count = checking_.load(std::memory_order_relaxed);
+    do
+    {
+        if (count >= limit)
+            return false;
+    }
+    while (!checking_.compare_exchange_weak(count, add1(count),
+        std::memory_order_relaxed));
+
+    boost::asio::post(checker_.service(),
+        [this, work = std::move(work)]() NOEXCEPT
+        {
+            work();
+            checking_.fetch_sub(one, std::memory_order_relaxed);
+        });
+
+    return true;
+}
+
+// Endgame requests the same block of multiple channels, and each may pass
+// its own association test before any has written. The claim makes the test
+// and the write atomic without serializing writes of distinct blocks. Without
+// endgame or offloaded checks a block is not written concurrently, so the
+// claim is bypassed. Association is tested outside of the critical section.
+code full_node::archive_block(bool& redundant, const chain::block& block,
+    const header_link& link, bool checked) NOEXCEPT
+{
+    redundant = false;
+    if (is_zero(config_.node.endgame_blocks) &&
+        is_zero(config_.node.check_threads))
+        return query_.set_code(block, link, checked);
+
+    {
+        std::unique_lock lock(archiving_mutex_);
+        if (!archiving_.insert(link.value).second)
+        {
+            redundant = true;
+            return error::success;
+        }
+    }
+
+    // A prior claimant has released only after its write, so this is final.
+    code ec{};
+    redundant = query_.is_associated(link);
+    if (!redundant)
+        ec = query_.set_code(block, link, checked);
+
+    std::unique_lock lock(archiving_mutex_);
+    archiving_.erase(link.value);
+    return ec;
+}
+
+const block_telemetry& full_node::get_telemetry() const NOEXCEPT
+{
+    return memory_.telemetry();
+}
+
+const block_memory& full_node::get_recycling() const NOEXCEPT
+{
+    return memory_;
+}
+
 // Session attachments.
 // ----------------------------------------------------------------------------
 
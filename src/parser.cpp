@@ -1038,6 +1038,21 @@ options_metadata parser::load_settings() THROWS
         value<uint16_t>(&configured.node.allocation_multiple),
         "Block deserialization buffer multiple of wire size, defaults to '20' (0 disables)."
     )
+    (
+        "node.allocation_adaptive",
+        value<bool>(&configured.node.allocation_adaptive),
+        "Adapt block deserialization buffer size to observed allocations, defaults to 'false'."
+    )
+    (
+        "node.allocation_mapping",
+        value<bool>(&configured.node.allocation_mapping),
+        "Memory map block deserialization buffers (huge page, numa local), defaults to 'false'."
+    )
+    (
+        "node.allocation_retention",
+        value<uint64_t>(&configured.node.allocation_retention),
+        "Per thread bytes of recycled block deserialization buffers, defaults to '0' (0 disables)."
+    )
     (
         "node.maximum_height",
         value<uint32_t>(&configured.node.maximum_height),
@@ -1048,6 +1063,32 @@ options_metadata parser::load_settings() THROWS
         value<uint32_t>(&configured.node.maximum_concurrency),
         "Maximum number of blocks to download concurrently, defaults to '50000' (0 disables)."
     )
+    (
+        "node.endgame_blocks",
+        value<uint32_t>(&configured.node.endgame_blocks),
+        "Maximum redundant requests for outstanding blocks once download work is exhausted, defaults to '0' (0 disables)."
+    )
+    (
+        "node.download_batches",
+        value<uint16_t>(&configured.node.download_batches),
+        "Maximum overlapping block request batches per channel, defaults to '1'."
+    )
+    (
+        "node.slow_policy",
+        value<std::string>(&configured.node.slow_policy)->notifier(
+            [](const std::string& policy) THROWS
+            {
+                if (policy != "deviation" && policy != "percentile" &&
+                    policy != "latency")
+                    throw invalid_option_value(policy);
+            }),
+        "Slow channel eviction policy (deviation, percentile, latency), defaults to 'deviation'."
+    )
+    (
+        "node.slow_percentile",
+        value<uint16_t>(&configured.node.slow_percentile),
+        "Channels below this speed percentile are slow under the percentile policy, defaults to '10' (0 disables)."
+    )
     ////(
     ////    "node.snapshot_bytes",
     ////    value<uint64_t>(&configured.node.snapshot_bytes),
@@ -1068,6 +1109,41 @@ options_metadata parser::load_settings() THROWS
         value<uint16_t>(&configured.node.sample_period_seconds),
         "Sampling period for drop of stalled channels, defaults to '10' (0 disables)."
     )
+    (
+        "node.check_threads",
+        value<uint32_t>(&configured.node.check_threads),
+        "The number of threads that check and archive downloaded blocks off the channel, defaults to '0' (0 disables)."
+    )
+    (
+        "node.confirm_batch",
+        value<uint32_t>(&configured.node.confirm_batch),
+        "Maximum confirmed blocks notified together when not current, defaults to '0' (0 disables)."
+    )
+    (
+        "node.confirm_window",
+        value<uint32_t>(&configured.node.confirm_window),
+        "Maximum validated blocks checked for confirmability in parallel, defaults to '0' (0 disables)."
+    )
+    (
+        "node.prefetch_blocks",
+        value<uint32_t>(&configured.node.prefetch_blocks),
+        "Number of archived blocks read ahead of validation, defaults to '0' (0 disables)."
+    )
+    (
+        "node.populate_threads",
+        value<uint32_t>(&configured.node.populate_threads),
+        "The number of threads that populate block prevouts ahead of script validation, defaults to '0' (0 disables)."
+    )
+    (
+        "node.backlog_bytes",
+        value<uint64_t>(&configured.node.backlog_bytes),
+        "Maximum bytes of blocks outstanding for validation, defaults to '0' (0 disables)."
+    )
+    (
+        "node.tree_bytes",
+        value<uint64_t>(&configured.node.tree_bytes),
+        "Maximum bytes of unarchived branches cached in the header tree, defaults to '268435456' (0 disables)."
+    )
     (
         "node.currency_window_minutes",
         value<uint32_t>(&configured.node.currency_window_minutes),
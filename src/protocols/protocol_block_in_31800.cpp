@@ -19,6 +19,9 @@
 #include <bitcoin/node/protocols/protocol_block_in_31800.hpp>
 
 #include <algorithm>
+#if defined(HAVE_EXECUTION)
+#include <execution>
+#endif
 #include <bitcoin/node/chasers/chasers.hpp>
 #include <bitcoin/node/define.hpp>
 
@@ -72,7 +75,7 @@ void protocol_block_in_31800::subscribed(const code& ec, object_key) NOEXCEPT
     if (is_current(false))
     {
         start_performance();
-        get_hashes(BIND(handle_get_hashes, _1, _2, _3));
+        get_work();
     }
 }
 
@@ -134,6 +137,22 @@ bool protocol_block_in_31800::handle_event(const code&, chase event_,
 
             break;
         }
+        case chase::cancel:
+        {
+            // chase::cancel is posted by notify_one() using subscription key.
+            // 'value' is the height of a block redundantly requested (endgame).
+            BC_ASSERT(std::holds_alternative<height_t>(value));
+            POST(do_cancel, std::get<height_t>(value));
+            break;
+        }
+        case chase::shared:
+        {
+            // chase::shared is posted by notify_one() using subscription key.
+            // 'value' is the height of a block redundantly requested (endgame).
+            BC_ASSERT(std::holds_alternative<height_t>(value));
+            POST(do_shared, std::get<height_t>(value));
+            break;
+        }
         case chase::download:
         {
             // There are count blocks to download at/above given header.
@@ -173,7 +192,7 @@ void protocol_block_in_31800::do_get_downloads(count_t) NOEXCEPT
     {
         // Assume performance was stopped due to exhaustion.
         start_performance();
-        get_hashes(BIND(handle_get_hashes, _1, _2, _3));
+        get_work();
     }
 }
 
@@ -203,6 +222,37 @@ void protocol_block_in_31800::do_split(channel_t) NOEXCEPT
     stop(error::sacrificed_channel);
 }
 
+void protocol_block_in_31800::do_cancel(height_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    shared_.erase(height);
+    if (stopped())
+        return;
+
+    // Redundant work is only issued at the tail, so map is small.
+    const auto it = std::find_if(map_->pos_begin(), map_->pos_end(),
+        [=](const auto& item) NOEXCEPT
+        {
+            return item.context.height == height;
+        });
+
+    if (it == map_->pos_end())
+        return;
+
+    LOGV("Cancel block [" << height << "] from [" << authority() << "].");
+    map_->erase(map_->find(it->hash));
+    get_next();
+}
+
+void protocol_block_in_31800::do_shared(height_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (!stopped())
+        shared_.insert(height);
+}
+
 void protocol_block_in_31800::do_report(count_t sequence) NOEXCEPT
 {
     BC_ASSERT(stranded());
@@ -219,6 +269,7 @@ void protocol_block_in_31800::send_get_data(const map_ptr& map,
     const job::ptr& job) NOEXCEPT
 {
     BC_ASSERT(stranded());
+    fetching_ = false;
 
     if (stopped())
     {
@@ -226,19 +277,64 @@ void protocol_block_in_31800::send_get_data(const map_ptr& map,
         return;
     }
 
-    if (map->empty())
+    // Work is being purged, more is announced (chase::download) thereafter.
+    if (!job)
         return;
 
-    // There are two populated maps, return new and leave old in place.
-    if (!is_idle())
+    // Starved only once all outstanding batches have been received.
+    // A busy channel waits until idle to request again (and for endgame).
+    if (map->empty())
     {
-        restore(map);
+        if (is_idle())
+            notify(error::success, chase::starved, events_key());
+        else
+            low_water_ = zero;
+
         return;
     }
 
+    // The next batch is requested once this one is half received, so that up
+    // to batches_ overlap. A single batch is requested only when idle.
+    low_water_ = floored_subtract(sub1(batches_) * map->size(),
+        to_half(map->size()));
+
+    // All batches share the job of the current candidate chain (or purge).
     job_ = job;
-    map_ = map;
-    SEND(create_get_data(*map_), handle_send, _1);
+    requested();
+    SEND(create_get_data(*map), handle_send, _1);
+
+    // Outstanding batches are merged so that restore/split/purge are whole.
+    // Any duplicate left in map is already held by this channel.
+    map_->merge(*map);
+}
+
+void protocol_block_in_31800::get_work() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // One request for work is outstanding at a time.
+    if (fetching_)
+        return;
+
+    fetching_ = true;
+    get_hashes(is_idle(), BIND(handle_get_hashes, _1, _2, _3));
+}
+
+void protocol_block_in_31800::get_next() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // The next batch is requested only once outstanding work is below low
+    // water, not upon each received block, and always once idle.
+    if (is_idle())
+    {
+        job_.reset();
+        get_work();
+    }
+    else if (map_->size() < low_water_)
+    {
+        get_work();
+    }
 }
 
 get_data protocol_block_in_31800::create_get_data(
@@ -283,20 +379,146 @@ bool protocol_block_in_31800::handle_receive_block(const code& ec,
         return true;
     }
 
+    // Latency ends at arrival of a requested block, not at its completion.
+    responded();
+
     const auto link = it->link;
     const auto height = it->context.height;
 
-    // Check block.
+    // Repeated block is already being checked on the check threadpool.
+    if (checking_.contains(hash))
+    {
+        LOGR("Repeated block [" << encode_hash(hash) << ":" << height
+            << "] from [" << authority() << "].");
+        return true;
+    }
+
+    // Redundant (endgame) request was satisfied by another channel.
+    // Only blocks known to be shared can have been archived by another. This
+    // avoids a redundant check, archive_block is what prevents a second write.
+    if (shared_.contains(height) && query.is_associated(link))
+        return redundant_block(hash);
+
+    // Check and commit block.txs.
     // ........................................................................
 
     const auto checked = is_under_checkpoint(height);
-    const auto bypass = checked || query.is_milestone(link);
 
-    // Tx commitments and malleation are checked under bypass. Invalidity is
-    // only stored when a strong header has been stored, later to be found out
-    // as invalid and not malleable. Stored invalidity prevents repeat
-    // processing of the same invalid chain but is not necessary or desirable.
-    if (const auto code = check(*block, it->context, bypass))
+    // Blocks are independent (channels deliver out of order), so checks are
+    // not ordered. Block remains in map_ so that it is restored if stopped.
+    // The node caps in-flight checks across channels, otherwise check inline.
+    if (checking_.size() < checks_ &&
+        post_check(BIND(do_check_block, block, link, it->context, checked)))
+    {
+        checking_.insert(hash);
+        return true;
+    }
+
+    const auto result = check_block(*block, link, it->context, checked);
+
+    code store{};
+    auto redundant = false;
+    if (!result)
+        store = archive_block(redundant, *block, link, checked);
+
+    if (redundant)
+        return redundant_block(hash);
+
+    return complete_block(result, store, block);
+}
+
+// Thread safe, invoked on the check threadpool.
+void protocol_block_in_31800::do_check_block(const block::cptr& block,
+    const header_link& link, const chain::context& ctx, bool checked) NOEXCEPT
+{
+    const auto ec = check_block(*block, link, ctx, checked);
+
+    code store{};
+    auto redundant = false;
+    if (!ec)
+        store = archive_block(redundant, *block, link, checked);
+
+    POST(handle_check_block, ec, store, redundant, block, ctx.height);
+}
+
+void protocol_block_in_31800::handle_check_block(const code& ec,
+    const code& store, bool redundant, const block::cptr& block,
+    size_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    const auto& hash = block->get_hash();
+    checking_.erase(hash);
+
+    // Another channel archived (and announced) the block, not written here.
+    if (redundant)
+    {
+        if (!stopped() && map_->find(hash) != map_->end())
+            redundant_block(hash);
+
+        return;
+    }
+
+    // Work was restored (or cancelled), an archived block remains associated.
+    // It must still be announced, otherwise it is downloaded and stored again.
+    if (stopped() || map_->find(hash) == map_->end())
+    {
+        if (!ec && !store)
+        {
+            notify(error::success, chase::checked, height);
+            fire(events::block_archived, height);
+        }
+
+        return;
+    }
+
+    complete_block(ec, store, block);
+}
+
+bool protocol_block_in_31800::redundant_block(const hash_digest& hash) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    const auto it = map_->find(hash);
+    BC_ASSERT(it != map_->end());
+
+    const auto height = it->context.height;
+    LOGV("Redundant block [" << encode_hash(hash) << ":" << height
+        << "] from [" << authority() << "].");
+
+    shared_.erase(height);
+    map_->erase(it);
+    get_next();
+    return true;
+}
+
+// Thread safe.
+code protocol_block_in_31800::check_block(const chain::block& block,
+    const header_link& link, const chain::context& ctx,
+    bool checked) const NOEXCEPT
+{
+    // Tx commitments and malleation are checked under bypass.
+    const auto bypass = checked || archive().is_milestone(link);
+    return check(block, ctx, bypass);
+}
+
+bool protocol_block_in_31800::complete_block(const code& ec,
+    const code& store, const block::cptr& block) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    const auto& hash = block->get_hash();
+    const auto it = map_->find(hash);
+    BC_ASSERT(it != map_->end());
+
+    auto& query = archive();
+    const auto link = it->link;
+    const auto height = it->context.height;
+
+    // Invalidity is only stored when a strong header has been stored, later to
+    // be found out as invalid and not malleable. Stored invalidity prevents
+    // repeat processing of the same invalid chain but is not necessary or
+    // desirable.
+    if (const auto& code = ec)
     {
         if (code == system::error::invalid_transaction_commitment ||
             code == system::error::invalid_witness_commitment)
@@ -323,15 +545,12 @@ bool protocol_block_in_31800::handle_receive_block(const code& ec,
         return false;
     }
 
-    // Commit block.txs.
-    // ........................................................................
-
-    if (const auto code = query.set_code(*block, link, checked))
+    if (store)
     {
         LOGF("Failure storing block [" << encode_hash(hash) << ":" << height
-            << "] from [" << authority() << "] " << code.message());
+            << "] from [" << authority() << "] " << store.message());
 
-        stop(fault(code));
+        stop(fault(store));
         return false;
     }
 
@@ -341,17 +560,13 @@ bool protocol_block_in_31800::handle_receive_block(const code& ec,
     LOGP("Downloaded block [" << encode_hash(hash) << ":" << height
         << "] from [" << authority() << "].");
 
-    notify(ec, chase::checked, height);
+    notify(error::success, chase::checked, height);
     fire(events::block_archived, height);
 
     count(block->serialized_size(true));
+    shared_.erase(height);
     map_->erase(it);
-    if (is_idle())
-    {
-        job_.reset();
-        get_hashes(BIND(handle_get_hashes, _1, _2, _3));
-    }
-
+    get_next();
     return true;
 }
 
@@ -362,6 +577,8 @@ code protocol_block_in_31800::check(const chain::block& block,
     const chain::context& ctx, bool bypass) const NOEXCEPT
 {
     code ec{};
+    hash_transactions(block);
+
     if (bypass)
     {
         if (((ec = block.identify())) || ((ec = block.identify(ctx))))
@@ -376,13 +593,46 @@ code protocol_block_in_31800::check(const chain::block& block,
     return error::success;
 }
 
+// Transaction hashes are cached on each transaction, so precomputing them
+// concurrently shifts merkle and witness commitment hashing off this thread.
+// Coinbase witness hash is null_hash (bip141) and is never cached here.
+void protocol_block_in_31800::hash_transactions(
+    const chain::block& block) NOEXCEPT
+{
+    const auto& txs = *block.transactions_ptr();
+    if (txs.size() < minimum_parallel_hashing)
+        return;
+
+    const auto witness = block.is_segregated();
+    const auto hash = [witness](const auto& tx) NOEXCEPT
+    {
+        tx->set_nominal_hash(tx->hash(false));
+        if (witness && tx->is_segregated())
+            tx->set_witness_hash(tx->hash(true));
+    };
+
+#if defined(HAVE_EXECUTION)
+    std::for_each(std::execution::par, std::next(txs.begin()),
+        txs.end(), hash);
+#else
+    std::for_each(std::next(txs.begin()), txs.end(), hash);
+#endif
+}
+
 // get/put hashes
 // ----------------------------------------------------------------------------
 
+// Merged batches may exceed max_inventory, so work is restored in batches.
 void protocol_block_in_31800::restore(const map_ptr& map) NOEXCEPT
 {
-    if (!map->empty())
-        put_hashes(map, BIND(handle_put_hashes, _1, map->size()));
+    auto& index = map->get<association::pos>();
+    while (!map->empty())
+    {
+        const auto batch = chaser_check::empty_map();
+        const auto count = std::min(map->size(), max_inventory);
+        batch->merge(index, index.begin(), std::next(index.begin(), count));
+        put_hashes(batch, BIND(handle_put_hashes, _1, batch->size()));
+    }
 }
 
 void protocol_block_in_31800::handle_put_hashes(const code& ec,
@@ -407,19 +657,20 @@ void protocol_block_in_31800::handle_get_hashes(const code& ec,
         return;
     }
 
-    if (ec)
+    if (ec == network::error::service_stopped)
     {
-        LOGF("Error getting work for [" << authority() << "] " << ec.message());
         stop(ec);
         return;
     }
 
-    if (map->empty())
+    if (ec)
     {
-        notify(error::success, chase::starved, events_key());
+        LOGF("Error getting work for [" << authority() << "] " << ec.message());
+        stop(ec);
         return;
     }
 
+    // Empty map is handled on the strand, as other batches may be pending.
     POST(send_get_data, map, job);
 }
 
@@ -44,25 +44,39 @@ void protocol_peer::organize(const system::chain::block::cptr& block,
     session_->organize(block, std::move(handler));
 }
 
-void protocol_peer::get_hashes(map_handler&& handler) NOEXCEPT
+void protocol_peer::get_hashes(bool idle, map_handler&& handler) NOEXCEPT
 {
-    session_->get_hashes(std::move(handler));
+    // Channel key sizes work to the channel's reported performance.
+    session_->get_hashes(key_, idle, std::move(handler));
 }
 
 void protocol_peer::put_hashes(const map_ptr& map,
     network::result_handler&& handler) NOEXCEPT
 {
-    session_->put_hashes(map, std::move(handler));
+    // Channel key releases the channel's hold on redundantly issued work.
+    session_->put_hashes(key_, map, std::move(handler));
 }
 
 // Methods.
 // ----------------------------------------------------------------------------
 
-void protocol_peer::performance(uint64_t speed,
+void protocol_peer::performance(uint64_t speed, uint64_t latency,
     network::result_handler&& handler) const NOEXCEPT
 {
     // Passed protocol->session->full_node->check_chaser.post->do_update.
-    session_->performance(key_, speed, std::move(handler));
+    session_->performance(key_, speed, latency, std::move(handler));
+}
+
+bool protocol_peer::post_check(work_handler&& work) const NOEXCEPT
+{
+    return session_->post_check(std::move(work));
+}
+
+code protocol_peer::archive_block(bool& redundant,
+    const system::chain::block& block, const database::header_link& link,
+    bool checked) const NOEXCEPT
+{
+    return session_->archive_block(redundant, block, link, checked);
 }
 
 code protocol_peer::fault(const code& ec) NOEXCEPT
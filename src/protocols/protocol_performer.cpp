@@ -98,7 +98,7 @@ void protocol_performer::send_performance(uint64_t rate) NOEXCEPT
         if (deviation_)
         {
             performance_timer_->stop();
-            performance(rate, BIND(handle_send_performance, _1));
+            performance(rate, latency_, BIND(handle_send_performance, _1));
             return;
         }
 
@@ -157,5 +157,30 @@ void protocol_performer::count(size_t bytes) NOEXCEPT
     bytes_ = ceilinged_add(bytes_, possible_wide_cast<uint64_t>(bytes));
 }
 
+void protocol_performer::requested() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // Outstanding requests are not restarted by subsequent requests.
+    if (!awaiting_)
+    {
+        awaiting_ = true;
+        requested_ = steady_clock::now();
+    }
+}
+
+void protocol_performer::responded() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (awaiting_)
+    {
+        // Latency is nonzero once measured (zero implies not measured).
+        awaiting_ = false;
+        latency_ = greater(sign_cast<uint64_t>(duration_cast<milliseconds>(
+            steady_clock::now() - requested_).count()), one);
+    }
+}
+
 } // namespace node
 } // namespace libbitcoin
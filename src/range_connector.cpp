@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/range_connector.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+range_connector::range_connector(size_t first, size_t count, size_t range,
+    connector&& connect) NOEXCEPT
+  : first_(std::min(first, count)),
+    count_(count),
+    range_(std::max(range, one)),
+    connect_(std::move(connect)),
+    cursor_(first_),
+    completed_(first_)
+{
+}
+
+size_t range_connector::ranges() const NOEXCEPT
+{
+    return ceilinged_divide(count_ - first_, range_);
+}
+
+void range_connector::run() NOEXCEPT
+{
+    auto first = cursor_.fetch_add(range_);
+    for (; first < count_; first = cursor_.fetch_add(range_))
+    {
+        const auto last = std::min(first + range_, count_);
+
+        // Remaining ranges are skipped (but completed) once any has failed.
+        for (auto index = first; index < last && !failed_; ++index)
+        {
+            if (const auto ec = connect_(index))
+            {
+                std::unique_lock lock(mutex_);
+                if (!ec_ || index < index_)
+                {
+                    index_ = index;
+                    ec_ = ec;
+                }
+
+                failed_ = true;
+                break;
+            }
+        }
+
+        if (completed_.fetch_add(last - first) + (last - first) == count_)
+        {
+            std::unique_lock lock(mutex_);
+            done_.notify_all();
+        }
+    }
+}
+
+code range_connector::wait() NOEXCEPT
+{
+    std::unique_lock lock(mutex_);
+    done_.wait(lock, [&]() NOEXCEPT
+    {
+        return completed_.load() == count_;
+    });
+
+    return ec_;
+}
+
+} // namespace node
+} // namespace libbitcoin
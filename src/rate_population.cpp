@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/rate_population.hpp>
+
+#include <algorithm>
+#include <bitcoin/node/define.hpp>
+#include <bitcoin/node/rate_statistics.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+void rate_population::set(object_key channel, double speed,
+    double latency) NOEXCEPT
+{
+    order(speeds_, channel, speed);
+    set(speeds_, speed_, channel, speed);
+
+    // Latency is measured only once the channel has received requested data.
+    if (latency > 0.0)
+        set(latencies_, latency_, channel, latency);
+}
+
+void rate_population::erase(object_key channel) NOEXCEPT
+{
+    disorder(speeds_, channel);
+    erase(speeds_, speed_, channel);
+    erase(latencies_, latency_, channel);
+}
+
+void rate_population::clear() NOEXCEPT
+{
+    speeds_.clear();
+    latencies_.clear();
+    ordered_.clear();
+    speed_.clear();
+    latency_.clear();
+}
+
+const rate_population::rates& rate_population::speeds() const NOEXCEPT
+{
+    return speeds_;
+}
+
+const rate_statistics& rate_population::speed() const NOEXCEPT
+{
+    return speed_;
+}
+
+const rate_population::values& rate_population::ordered() const NOEXCEPT
+{
+    return ordered_;
+}
+
+double rate_population::percentile(size_t percent) const NOEXCEPT
+{
+    if (ordered_.empty())
+        return 0.0;
+
+    // Nearest rank (rounded down), so the highest rank is the last value.
+    const auto rank = std::min(sub1(ordered_.size()),
+        (ordered_.size() * std::min<size_t>(percent, 100)) / 100u);
+    return ordered_.at(rank);
+}
+
+const rate_population::rates& rate_population::latencies() const NOEXCEPT
+{
+    return latencies_;
+}
+
+const rate_statistics& rate_population::latency() const NOEXCEPT
+{
+    return latency_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// static
+void rate_population::set(rates& map, rate_statistics& statistics,
+    object_key channel, double value) NOEXCEPT
+{
+    const auto it = map.find(channel);
+    if (it == map.end())
+    {
+        map.emplace(channel, value);
+        statistics.add(value);
+        return;
+    }
+
+    statistics.replace(it->second, value);
+    it->second = value;
+}
+
+// static
+void rate_population::erase(rates& map, rate_statistics& statistics,
+    object_key channel) NOEXCEPT
+{
+    const auto it = map.find(channel);
+    if (it == map.end())
+        return;
+
+    statistics.remove(it->second);
+    map.erase(it);
+}
+
+// Ordered values are maintained by binary search, so that order statistics
+// are not recomputed (copied and partitioned) upon each query.
+void rate_population::order(const rates& map, object_key channel,
+    double value) NOEXCEPT
+{
+    disorder(map, channel);
+    ordered_.insert(std::upper_bound(ordered_.begin(), ordered_.end(), value),
+        value);
+}
+
+void rate_population::disorder(const rates& map, object_key channel) NOEXCEPT
+{
+    const auto it = map.find(channel);
+    if (it == map.end())
+        return;
+
+    const auto value = std::lower_bound(ordered_.begin(), ordered_.end(),
+        it->second);
+    if (value != ordered_.end())
+        ordered_.erase(value);
+}
+
+} // namespace node
+} // namespace libbitcoin
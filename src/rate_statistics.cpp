@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/rate_statistics.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+void rate_statistics::add(double rate) NOEXCEPT
+{
+    ++count_;
+    const auto delta = rate - mean_;
+    mean_ += delta / to_floating(count_);
+    squares_ += delta * (rate - mean_);
+}
+
+void rate_statistics::remove(double rate) NOEXCEPT
+{
+    if (count_ <= one)
+    {
+        clear();
+        return;
+    }
+
+    const auto mean = mean_;
+    mean_ = (to_floating(count_) * mean - rate) / to_floating(sub1(count_));
+    --count_;
+
+    // Accumulated rounding cannot be allowed to produce negative variance.
+    squares_ = std::max(squares_ - (rate - mean) * (rate - mean_), 0.0);
+}
+
+void rate_statistics::replace(double from, double to) NOEXCEPT
+{
+    remove(from);
+    add(to);
+}
+
+void rate_statistics::clear() NOEXCEPT
+{
+    count_ = zero;
+    mean_ = 0.0;
+    squares_ = 0.0;
+}
+
+size_t rate_statistics::count() const NOEXCEPT
+{
+    return count_;
+}
+
+double rate_statistics::mean() const NOEXCEPT
+{
+    return mean_;
+}
+
+double rate_statistics::total() const NOEXCEPT
+{
+    return mean_ * to_floating(count_);
+}
+
+double rate_statistics::variance() const NOEXCEPT
+{
+    return count_ < two ? 0.0 : squares_ / to_floating(sub1(count_));
+}
+
+double rate_statistics::deviation() const NOEXCEPT
+{
+    return std::sqrt(variance());
+}
+
+} // namespace node
+} // namespace libbitcoin
@@ -54,15 +54,16 @@ void session::organize(const block::cptr& block,
     node_.organize(block, std::move(handler));
 }
 
-void session::get_hashes(map_handler&& handler) NOEXCEPT
+void session::get_hashes(object_key channel, bool idle,
+    map_handler&& handler) NOEXCEPT
 {
-    node_.get_hashes(std::move(handler));
+    node_.get_hashes(channel, idle, std::move(handler));
 }
 
-void session::put_hashes(const map_ptr& map,
+void session::put_hashes(object_key channel, const map_ptr& map,
     network::result_handler&& handler) NOEXCEPT
 {
-    node_.put_hashes(map, std::move(handler));
+    node_.put_hashes(channel, map, std::move(handler));
 }
 
 // Events.
@@ -100,9 +101,20 @@ void session::unsubscribe_events(object_key key) NOEXCEPT
 // ----------------------------------------------------------------------------
 
 void session::performance(object_key key, uint64_t speed,
-    result_handler&& handler) NOEXCEPT
+    uint64_t latency, result_handler&& handler) NOEXCEPT
 {
-    node_.performance(key, speed, std::move(handler));
+    node_.performance(key, speed, latency, std::move(handler));
+}
+
+bool session::post_check(work_handler&& work) NOEXCEPT
+{
+    return node_.post_check(std::move(work));
+}
+
+code session::archive_block(bool& redundant, const block& block,
+    const header_link& link, bool checked) NOEXCEPT
+{
+    return node_.archive_block(redundant, block, link, checked);
 }
 
 network::memory& session::get_memory() const NOEXCEPT
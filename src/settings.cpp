@@ -85,16 +85,30 @@ settings::settings() NOEXCEPT
     headers_first{ true },
     memory_priority{ true },
     thread_priority{ true },
+    allocation_mapping{ false },
+    allocation_adaptive{ false },
     allowed_deviation{ 1.5 },
     announcement_cache{ 42 },
     allocation_multiple{ 20 },
+    allocation_retention{ 0 },
     ////snapshot_bytes{ 200'000'000'000 },
     ////snapshot_valid{ 250'000 },
     ////snapshot_confirm{ 500'000 },
     maximum_height{ 0 },
     maximum_concurrency{ 50'000 },
+    endgame_blocks{ 0 },
+    download_batches{ 1 },
+    slow_policy{ "deviation" },
+    slow_percentile{ 10 },
     sample_period_seconds{ 10 },
     currency_window_minutes{ 60 },
+    check_threads{ 0 },
+    confirm_batch{ 0 },
+    confirm_window{ 0 },
+    prefetch_blocks{ 0 },
+    populate_threads{ 0 },
+    backlog_bytes{ 0 },
+    tree_bytes{ 268'435'456 },
     threads{ 1 }
 {
 }
@@ -120,6 +134,23 @@ size_t settings::maximum_concurrency_() const NOEXCEPT
     return to_bool(maximum_concurrency) ? maximum_concurrency : max_size_t;
 }
 
+eviction settings::slow_policy_() const NOEXCEPT
+{
+    // The parser rejects unrecognized names, otherwise standard deviation.
+    if (slow_policy == "percentile")
+        return eviction::percentile;
+
+    if (slow_policy == "latency")
+        return eviction::latency;
+
+    return eviction::deviation;
+}
+
+size_t settings::download_batches_() const NOEXCEPT
+{
+    return std::max<size_t>(download_batches, one);
+}
+
 network::steady_clock::duration settings::sample_period() const NOEXCEPT
 {
     return network::seconds(sample_period_seconds);
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/slow_policy.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <bitcoin/node/define.hpp>
+#include <bitcoin/node/rate_population.hpp>
+#include <bitcoin/node/settings.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// slow_policy
+// ----------------------------------------------------------------------------
+
+// static
+slow_policy::ptr slow_policy::create(const settings& config) NOEXCEPT
+{
+    switch (config.slow_policy_())
+    {
+        case eviction::percentile:
+            return std::make_unique<percentile_policy>(
+                config.slow_percentile);
+        case eviction::latency:
+            return std::make_unique<latency_policy>(
+                config.allowed_deviation);
+        case eviction::deviation:
+        default:
+            return std::make_unique<deviation_policy>(
+                config.allowed_deviation);
+    }
+}
+
+// static
+slow_policy::replay_result slow_policy::replay(const slow_policy& policy,
+    const trace& records) NOEXCEPT
+{
+    replay_result result{};
+    rate_population population{};
+    std::unordered_set<object_key> dropped{};
+    std::unordered_map<object_key, double> replaced{};
+
+    for (const auto& sample: records)
+    {
+        // Dropped channels are stopped and so report nothing further.
+        if (dropped.contains(sample.channel))
+            continue;
+
+        ++result.samples;
+
+        // Evicted channel's slot reports as its replacement would.
+        const auto it = replaced.find(sample.channel);
+        if (it != replaced.end())
+        {
+            result.throughput += it->second;
+            continue;
+        }
+
+        if (sample.speed == max_uint64)
+        {
+            population.erase(sample.channel);
+            continue;
+        }
+
+        if (is_zero(sample.speed))
+        {
+            population.erase(sample.channel);
+            dropped.insert(sample.channel);
+            continue;
+        }
+
+        const auto speed = to_floating(sample.speed);
+        result.throughput += speed;
+        population.set(sample.channel, speed, to_floating(sample.latency));
+
+        if (policy.is_slow(sample.channel, population))
+        {
+            ++result.evictions;
+            population.erase(sample.channel);
+            replaced.emplace(sample.channel, population.speed().mean());
+        }
+    }
+
+    return result;
+}
+
+// deviation_policy
+// ----------------------------------------------------------------------------
+
+deviation_policy::deviation_policy(float allowed_deviation) NOEXCEPT
+  : allowed_deviation_(allowed_deviation)
+{
+}
+
+bool deviation_policy::is_slow(object_key channel,
+    const rate_population& population) const NOEXCEPT
+{
+    const auto& statistics = population.speed();
+    if (statistics.count() <= minimum_population)
+        return false;
+
+    const auto it = population.speeds().find(channel);
+    if (it == population.speeds().end())
+        return false;
+
+    const auto mean = statistics.mean();
+    const auto speed = it->second;
+    if (speed >= mean)
+        return false;
+
+    return (mean - speed) > (allowed_deviation_ * statistics.deviation());
+}
+
+// percentile_policy
+// ----------------------------------------------------------------------------
+
+percentile_policy::percentile_policy(uint16_t percentile) NOEXCEPT
+  : percentile_(std::min<size_t>(percentile, 100))
+{
+}
+
+bool percentile_policy::is_slow(object_key channel,
+    const rate_population& population) const NOEXCEPT
+{
+    const auto& speeds = population.speeds();
+    if (is_zero(percentile_) || speeds.size() <= minimum_population)
+        return false;
+
+    const auto it = speeds.find(channel);
+    if (it == speeds.end())
+        return false;
+
+    // Nearest rank (rounded down), so at least one channel is not slow.
+    return it->second < population.percentile(percentile_);
+}
+
+// latency_policy
+// ----------------------------------------------------------------------------
+
+latency_policy::latency_policy(float allowed_deviation) NOEXCEPT
+  : allowed_deviation_(allowed_deviation)
+{
+}
+
+bool latency_policy::is_slow(object_key channel,
+    const rate_population& population) const NOEXCEPT
+{
+    const auto& statistics = population.latency();
+    if (statistics.count() <= minimum_population)
+        return false;
+
+    const auto it = population.latencies().find(channel);
+    if (it == population.latencies().end())
+        return false;
+
+    const auto mean = statistics.mean();
+    const auto latency = it->second;
+    if (latency <= mean)
+        return false;
+
+    return (latency - mean) > (allowed_deviation_ * statistics.deviation());
+}
+
+BC_POP_WARNING()
+
+} // namespace node
+} // namespace libbitcoin
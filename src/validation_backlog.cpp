@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/validation_backlog.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+// Baseline cost drifts toward observed cost, so that a change in block
+// composition (script mix) does not pin the limit at minimum.
+constexpr double baseline_drift = 1.0 / 16.0;
+
+validation_backlog::validation_backlog(size_t threads, size_t maximum,
+    uint64_t memory) NOEXCEPT
+  : minimum_(std::max(threads, one)),
+    maximum_(std::max(maximum, minimum_)),
+    window_(minimum_),
+    memory_(memory),
+    limit_(maximum_)
+{
+}
+
+size_t validation_backlog::limit() const NOEXCEPT
+{
+    return limit_.load(std::memory_order_relaxed);
+}
+
+uint64_t validation_backlog::outstanding() const NOEXCEPT
+{
+    return outstanding_.load(std::memory_order_relaxed);
+}
+
+size_t validation_backlog::queued() const NOEXCEPT
+{
+    std::unique_lock lock(mutex_);
+    return queued_;
+}
+
+void validation_backlog::queue() NOEXCEPT
+{
+    std::unique_lock lock(mutex_);
+    ++queued_;
+}
+
+void validation_backlog::dequeue() NOEXCEPT
+{
+    std::unique_lock lock(mutex_);
+    queued_ = floored_subtract(queued_, one);
+}
+
+void validation_backlog::started(size_t bytes) NOEXCEPT
+{
+    const auto total = outstanding_.fetch_add(bytes,
+        std::memory_order_relaxed) + bytes;
+
+    std::unique_lock lock(mutex_);
+    peak_ = std::max(peak_, total);
+}
+
+validation_backlog::bound validation_backlog::completed(size_t bytes,
+    uint64_t microseconds) NOEXCEPT
+{
+    outstanding_.fetch_sub(bytes, std::memory_order_relaxed);
+
+    // Utilization is sampled at each completion, as a worker frees.
+    std::unique_lock lock(mutex_);
+    waiting_ = std::min(waiting_, queued_);
+    if (is_zero(bytes))
+        return bound::none;
+
+    bytes_ = ceilinged_add(bytes_, uint64_t{ bytes });
+    microseconds_ = ceilinged_add(microseconds_, microseconds);
+    if (++count_ < window_)
+        return bound::none;
+
+    const auto result = adjust();
+    count_ = zero;
+    bytes_ = zero;
+    microseconds_ = zero;
+    waiting_ = max_size_t;
+    peak_ = outstanding();
+    return result;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// protected by mutex
+validation_backlog::bound validation_backlog::adjust() NOEXCEPT
+{
+    const auto limit = limit_.load(std::memory_order_relaxed);
+
+    // Outstanding blocks exceed memory, back off quickly.
+    if (is_nonzero(memory_) && peak_ > memory_)
+    {
+        limit_.store(std::max(minimum_, to_half(limit)));
+        return bound::memory;
+    }
+
+    // Validation cost per byte over the window.
+    const auto cost = to_floating(microseconds_) /
+        to_floating(std::max(bytes_, uint64_t{ one }));
+
+    // Cost well above baseline implies contention on the store (page faults),
+    // which additional concurrent validations only aggravate.
+    if (is_nonzero(baseline_) && cost > baseline_ * store_ratio)
+    {
+        baseline_ += (cost - baseline_) * baseline_drift;
+        const auto step = std::max(one, limit / 4u);
+        limit_.store(std::max(minimum_, floored_subtract(limit, step)));
+        return bound::store;
+    }
+
+    baseline_ = is_zero(baseline_) ? cost : std::min(baseline_, cost);
+
+    // A window's worth of validations always awaited a worker, so fewer
+    // outstanding would not idle workers (and hold fewer blocks in memory).
+    if (waiting_ >= window_)
+    {
+        limit_.store(std::max(minimum_, floored_subtract(limit, window_)));
+        return bound::cpu;
+    }
+
+    // Workers were always busy, more outstanding would only wait.
+    if (is_nonzero(waiting_))
+        return bound::cpu;
+
+    // Validation keeps pace with concurrency, allow more outstanding.
+    limit_.store(std::min(maximum_, ceilinged_add(limit, window_)));
+    return bound::cpu;
+}
+
+} // namespace node
+} // namespace libbitcoin
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(association_bitmap_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(association_bitmap__clear__base__empty)
+{
+    association_bitmap instance{};
+    instance.clear(42);
+    BOOST_REQUIRE_EQUAL(instance.base(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.top(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.to_unassociated(1), 43u);
+    BOOST_REQUIRE_EQUAL(instance.to_unassociated(43), 43u);
+    BOOST_REQUIRE_EQUAL(instance.count_unassociated(42, 10), zero);
+}
+
+BOOST_AUTO_TEST_CASE(association_bitmap__load__predicate__queried_once_each)
+{
+    auto calls = zero;
+    association_bitmap instance{};
+    instance.clear(10);
+    const auto even = [&](size_t height) NOEXCEPT
+    {
+        ++calls;
+        return is_even(height);
+    };
+
+    instance.load(20, even);
+    instance.load(15, even);
+    instance.load(20, even);
+    BOOST_REQUIRE_EQUAL(calls, 10u);
+    BOOST_REQUIRE_EQUAL(instance.top(), 20u);
+    BOOST_REQUIRE_EQUAL(instance.to_unassociated(12), 13u);
+    BOOST_REQUIRE_EQUAL(instance.count_unassociated(10, 10), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(association_bitmap__set__loaded__associated)
+{
+    association_bitmap instance{};
+    instance.clear(zero);
+    instance.load(100, [](size_t) NOEXCEPT { return false; });
+    instance.set(1);
+    instance.set(2);
+    instance.set(101);
+    BOOST_REQUIRE_EQUAL(instance.to_unassociated(1), 3u);
+    BOOST_REQUIRE_EQUAL(instance.count_unassociated(zero, 100), 98u);
+    BOOST_REQUIRE_EQUAL(instance.to_unassociated(101), 101u);
+}
+
+BOOST_AUTO_TEST_CASE(association_bitmap__reset__above_base__unloads_above)
+{
+    association_bitmap instance{};
+    instance.clear(zero);
+    instance.load(200, [](size_t) NOEXCEPT { return true; });
+    instance.reset(70);
+    BOOST_REQUIRE_EQUAL(instance.top(), 70u);
+    BOOST_REQUIRE_EQUAL(instance.to_unassociated(1), 71u);
+
+    instance.load(80, [](size_t) NOEXCEPT { return false; });
+    BOOST_REQUIRE_EQUAL(instance.to_unassociated(1), 71u);
+    BOOST_REQUIRE_EQUAL(instance.count_unassociated(zero, 80), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(association_bitmap__reset__below_base__cleared)
+{
+    association_bitmap instance{};
+    instance.clear(50);
+    instance.load(60, [](size_t) NOEXCEPT { return true; });
+    instance.reset(40);
+    BOOST_REQUIRE_EQUAL(instance.base(), 40u);
+    BOOST_REQUIRE_EQUAL(instance.top(), 40u);
+}
+
+BOOST_AUTO_TEST_CASE(association_bitmap__advance__run_longer_than_two_windows__first_unassociated)
+{
+    // Associated run (restart near tip) far exceeds twice the window.
+    constexpr size_t window = 100;
+    constexpr size_t gap = 1'000;
+    auto calls = zero;
+    association_bitmap instance{};
+    instance.clear(zero);
+    const auto height = instance.advance(zero, window, 5'000,
+        [&](size_t value) NOEXCEPT
+        {
+            ++calls;
+            return value != gap;
+        });
+
+    BOOST_REQUIRE_EQUAL(height, gap);
+
+    // Loading extends only one window above the run.
+    BOOST_REQUIRE_EQUAL(instance.top(), sub1(gap) + window);
+    BOOST_REQUIRE_EQUAL(calls, instance.top());
+}
+
+BOOST_AUTO_TEST_CASE(association_bitmap__advance__all_associated__above_candidate)
+{
+    association_bitmap instance{};
+    instance.clear(zero);
+    const auto height = instance.advance(zero, 10, 345,
+        [](size_t) NOEXCEPT { return true; });
+
+    BOOST_REQUIRE_EQUAL(height, 346u);
+    BOOST_REQUIRE_EQUAL(instance.top(), 345u);
+}
+
+BOOST_AUTO_TEST_CASE(association_bitmap__advance__candidate_below_top__reset)
+{
+    association_bitmap instance{};
+    instance.clear(zero);
+    instance.load(100, [](size_t) NOEXCEPT { return true; });
+    const auto height = instance.advance(zero, 10, 50,
+        [](size_t) NOEXCEPT { return true; });
+
+    BOOST_REQUIRE_EQUAL(height, 51u);
+    BOOST_REQUIRE_EQUAL(instance.top(), 50u);
+}
+
+BOOST_AUTO_TEST_CASE(association_bitmap__advance__zero_window__next_height)
+{
+    association_bitmap instance{};
+    instance.clear(zero);
+    BOOST_REQUIRE_EQUAL(instance.advance(5, zero, 100,
+        [](size_t) NOEXCEPT { return true; }), 6u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -126,6 +126,11 @@ public:
         return capacity();
     }
 
+    static constexpr size_t to_mapped_(size_t size) NOEXCEPT
+    {
+        return to_mapped(size);
+    }
+
     void do_deallocate(void* ptr, size_t size, size_t offset) NOEXCEPT override
     {
         deallocated_ptr = ptr;
@@ -647,4 +652,91 @@ BOOST_AUTO_TEST_CASE(block_arena__do_is_equal__unequal__false)
     BOOST_REQUIRE(!instance1.is_equal(instance2));
 }
 
+// adaptive
+
+BOOST_AUTO_TEST_CASE(block_arena__start__adaptive_no_observation__fixed_multiple)
+{
+    constexpr auto multiple = 20u;
+    accessor instance{ multiple, nullptr, false, nullptr, true };
+    const auto memory = instance.start(100);
+    BOOST_REQUIRE_EQUAL(memory, instance.stack.back().data());
+    BOOST_REQUIRE_EQUAL(instance.get_size(), 100u * multiple);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__start__adaptive_observations__converges)
+{
+    constexpr auto multiple = 20u;
+    constexpr auto wire = 100u;
+    constexpr auto consumed = link_size + wire;
+    accessor instance{ multiple, nullptr, false, nullptr, true };
+
+    for (auto block = zero; block < 100u; ++block)
+    {
+        const auto memory = instance.start(wire);
+        BOOST_REQUIRE_NE(instance.allocate(wire, one), nullptr);
+        BOOST_REQUIRE_EQUAL(instance.detach(), consumed);
+        instance.release(memory);
+    }
+
+    // Deviation decays with uniform observations, toward consumed size.
+    BOOST_REQUIRE(instance.start(wire) != nullptr);
+    BOOST_REQUIRE_GE(instance.get_size(), consumed);
+    BOOST_REQUIRE_LE(instance.get_size(), add1(consumed));
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__start__not_adaptive_observations__fixed_multiple)
+{
+    constexpr auto multiple = 20u;
+    constexpr auto wire = 100u;
+    accessor instance{ multiple };
+
+    const auto memory = instance.start(wire);
+    BOOST_REQUIRE_NE(instance.allocate(wire, one), nullptr);
+    instance.detach();
+    instance.release(memory);
+
+    BOOST_REQUIRE(instance.start(wire) != nullptr);
+    BOOST_REQUIRE_EQUAL(instance.get_size(), wire * multiple);
+}
+
+// to_mapped
+
+BOOST_AUTO_TEST_CASE(block_arena__to_mapped__small__small_page_multiple)
+{
+    constexpr auto prefix = alignof(std::max_align_t);
+    static_assert(accessor::to_mapped_(zero) == 4096u);
+    static_assert(accessor::to_mapped_(4096u - prefix) == 4096u);
+    static_assert(accessor::to_mapped_(4096u) == 8192u);
+    BOOST_REQUIRE_EQUAL(accessor::to_mapped_(100'000), 102400u);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__to_mapped__large__huge_page_multiple)
+{
+    constexpr auto huge = 2u * 1024u * 1024u;
+    constexpr auto prefix = alignof(std::max_align_t);
+    static_assert(accessor::to_mapped_(huge - prefix) == huge);
+    static_assert(accessor::to_mapped_(huge) == 2u * huge);
+    BOOST_REQUIRE_EQUAL(accessor::to_mapped_(3u * huge - prefix), 3u * huge);
+}
+
+// mapped
+
+BOOST_AUTO_TEST_CASE(block_arena__start__mapped__not_malloced_not_freed)
+{
+    accessor instance{ 10, nullptr, true };
+    const auto memory = instance.start(100'000);
+    BOOST_REQUIRE_NE(memory, nullptr);
+    BOOST_REQUIRE(instance.stack.empty());
+
+    // Mapped memory is writable beyond the link.
+    const auto bytes = instance.allocate(900'000, one);
+    BOOST_REQUIRE_NE(bytes, nullptr);
+    std::fill_n(pointer_cast<uint8_t>(bytes), 900'000, 0xff_u8);
+
+    BOOST_REQUIRE_GE(instance.detach(), 900'000u);
+    instance.release(memory);
+    BOOST_REQUIRE(instance.stack.empty());
+    BOOST_REQUIRE(instance.freed.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
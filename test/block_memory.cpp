@@ -38,6 +38,11 @@ public:
         return arenas_.size();
     }
 
+    size_t get_pools() const NOEXCEPT
+    {
+        return pools_.size();
+    }
+
     arena* get_arena_at(size_t index) NOEXCEPT
     {
         return &arenas_.at(index);
@@ -192,4 +197,28 @@ BOOST_AUTO_TEST_CASE(block_memory__get_arena__overflow_threads__default_arena)
     BOOST_REQUIRE_EQUAL(count3b, 3u);
 }
 
+BOOST_AUTO_TEST_CASE(block_memory__get_arena__retain__pooled_not_default_arena)
+{
+    constexpr size_t multiple = 42;
+    constexpr size_t threads = 2;
+    constexpr size_t retain = 1'000;
+    accessor instance{ multiple, threads, retain, false, false };
+    BOOST_REQUIRE_EQUAL(instance.get_size(), threads);
+    BOOST_REQUIRE_EQUAL(instance.get_pools(), threads);
+    BOOST_REQUIRE_NE(instance.get_arena(), default_arena::get());
+    BOOST_REQUIRE_EQUAL(instance.hits(), zero);
+    BOOST_REQUIRE_EQUAL(instance.misses(), zero);
+    BOOST_REQUIRE_EQUAL(instance.retained(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_memory__construct__no_retain__no_pools)
+{
+    constexpr size_t multiple = 42;
+    constexpr size_t threads = 2;
+    constexpr size_t retain = 0;
+    accessor instance{ multiple, threads, retain, false, false };
+    BOOST_REQUIRE_EQUAL(instance.get_size(), threads);
+    BOOST_REQUIRE_EQUAL(instance.get_pools(), zero);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
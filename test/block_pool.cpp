@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_pool_tests)
+
+using namespace system;
+
+// to_class
+
+BOOST_AUTO_TEST_CASE(block_pool__to_class__below_minimum__minimum)
+{
+    BOOST_REQUIRE_EQUAL(block_pool::to_class(zero), block_pool::minimum_class);
+    BOOST_REQUIRE_EQUAL(block_pool::to_class(one), block_pool::minimum_class);
+    BOOST_REQUIRE_EQUAL(block_pool::to_class(block_pool::minimum_class), block_pool::minimum_class);
+}
+
+BOOST_AUTO_TEST_CASE(block_pool__to_class__power_of_two__unchanged)
+{
+    BOOST_REQUIRE_EQUAL(block_pool::to_class(8192u), 8192u);
+    BOOST_REQUIRE_EQUAL(block_pool::to_class(1048576u), 1048576u);
+}
+
+BOOST_AUTO_TEST_CASE(block_pool__to_class__between_classes__next_quarter)
+{
+    BOOST_REQUIRE_EQUAL(block_pool::to_class(8193u), 10240u);
+    BOOST_REQUIRE_EQUAL(block_pool::to_class(10000u), 10240u);
+    BOOST_REQUIRE_EQUAL(block_pool::to_class(10241u), 12288u);
+    BOOST_REQUIRE_EQUAL(block_pool::to_class(16383u), 16384u);
+}
+
+// get/put
+
+BOOST_AUTO_TEST_CASE(block_pool__get__empty__nullptr_miss)
+{
+    block_pool instance{ 100 };
+    BOOST_REQUIRE_EQUAL(instance.get(42), nullptr);
+    BOOST_REQUIRE_EQUAL(instance.hits(), zero);
+    BOOST_REQUIRE_EQUAL(instance.misses(), one);
+    BOOST_REQUIRE_EQUAL(instance.retained(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_pool__put__within_limit__retained)
+{
+    block_pool instance{ 100 };
+    data_chunk chunk(42, 0x00);
+    BOOST_REQUIRE(instance.put(chunk.data(), chunk.size()));
+    BOOST_REQUIRE_EQUAL(instance.retained(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.clear().size(), one);
+}
+
+BOOST_AUTO_TEST_CASE(block_pool__put__above_limit__false)
+{
+    block_pool instance{ 100 };
+    data_chunk chunk1(60, 0x00);
+    data_chunk chunk2(60, 0x00);
+    BOOST_REQUIRE(instance.put(chunk1.data(), chunk1.size()));
+    BOOST_REQUIRE(!instance.put(chunk2.data(), chunk2.size()));
+    BOOST_REQUIRE_EQUAL(instance.retained(), 60u);
+    BOOST_REQUIRE_EQUAL(instance.clear().size(), one);
+}
+
+BOOST_AUTO_TEST_CASE(block_pool__get__retained_same_class__hit)
+{
+    block_pool instance{ 100 };
+    data_chunk chunk(42, 0x00);
+    BOOST_REQUIRE(instance.put(chunk.data(), chunk.size()));
+    BOOST_REQUIRE_EQUAL(instance.get(chunk.size()), chunk.data());
+    BOOST_REQUIRE_EQUAL(instance.hits(), one);
+    BOOST_REQUIRE_EQUAL(instance.misses(), zero);
+    BOOST_REQUIRE_EQUAL(instance.retained(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_pool__get__retained_other_class__miss)
+{
+    block_pool instance{ 100 };
+    data_chunk chunk(42, 0x00);
+    BOOST_REQUIRE(instance.put(chunk.data(), chunk.size()));
+    BOOST_REQUIRE_EQUAL(instance.get(add1(chunk.size())), nullptr);
+    BOOST_REQUIRE_EQUAL(instance.hits(), zero);
+    BOOST_REQUIRE_EQUAL(instance.misses(), one);
+    BOOST_REQUIRE_EQUAL(instance.retained(), chunk.size());
+    BOOST_REQUIRE_EQUAL(instance.clear().size(), one);
+}
+
+BOOST_AUTO_TEST_CASE(block_pool__clear__retained__empties)
+{
+    block_pool instance{ 100 };
+    data_chunk chunk1(10, 0x00);
+    data_chunk chunk2(20, 0x00);
+    data_chunk chunk3(20, 0x00);
+    BOOST_REQUIRE(instance.put(chunk1.data(), chunk1.size()));
+    BOOST_REQUIRE(instance.put(chunk2.data(), chunk2.size()));
+    BOOST_REQUIRE(instance.put(chunk3.data(), chunk3.size()));
+    BOOST_REQUIRE_EQUAL(instance.retained(), 50u);
+    BOOST_REQUIRE_EQUAL(instance.clear().size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.retained(), zero);
+    BOOST_REQUIRE_EQUAL(instance.get(20), nullptr);
+}
+
+// block_arena
+
+BOOST_AUTO_TEST_CASE(block_pool__block_arena__release_start__recycles_chunk)
+{
+    block_pool pool{ 1'000'000 };
+    block_arena instance{ 10, &pool };
+
+    const auto memory = instance.start(1000);
+    BOOST_REQUIRE_NE(memory, nullptr);
+    BOOST_REQUIRE_EQUAL(pool.misses(), one);
+    instance.detach();
+    instance.release(memory);
+    BOOST_REQUIRE_EQUAL(pool.retained(), block_pool::to_class(10'000));
+
+    BOOST_REQUIRE_EQUAL(instance.start(1000), memory);
+    BOOST_REQUIRE_EQUAL(pool.hits(), one);
+    BOOST_REQUIRE_EQUAL(pool.retained(), zero);
+    instance.detach();
+    instance.release(memory);
+}
+
+BOOST_AUTO_TEST_CASE(block_pool__block_arena__release_above_limit__not_retained)
+{
+    block_pool pool{ 1'000 };
+    block_arena instance{ 10, &pool };
+
+    const auto memory = instance.start(1000);
+    instance.detach();
+    instance.release(memory);
+    BOOST_REQUIRE_EQUAL(pool.retained(), zero);
+    BOOST_REQUIRE_EQUAL(pool.misses(), one);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
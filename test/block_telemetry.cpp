@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_telemetry_tests)
+
+using namespace system;
+
+// record
+
+BOOST_AUTO_TEST_CASE(block_telemetry__construct__default__zeros)
+{
+    const block_telemetry instance{};
+    BOOST_REQUIRE_EQUAL(instance.blocks(), zero);
+    BOOST_REQUIRE_EQUAL(instance.overflows(), zero);
+    BOOST_REQUIRE_EQUAL(instance.wire_bytes(), zero);
+    BOOST_REQUIRE_EQUAL(instance.consumed_bytes(), zero);
+    BOOST_REQUIRE_EQUAL(instance.allocated_bytes(), zero);
+    BOOST_REQUIRE_EQUAL(instance.multiple(99.0), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_telemetry__record__zero_wire__not_recorded)
+{
+    block_telemetry instance{};
+    instance.record(0, 42, 42, 1);
+    BOOST_REQUIRE_EQUAL(instance.blocks(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_telemetry__record__single_chunk__expected)
+{
+    block_telemetry instance{};
+    instance.record(100, 250, 2000, 1);
+    BOOST_REQUIRE_EQUAL(instance.blocks(), one);
+    BOOST_REQUIRE_EQUAL(instance.overflows(), zero);
+    BOOST_REQUIRE_EQUAL(instance.wire_bytes(), 100u);
+    BOOST_REQUIRE_EQUAL(instance.consumed_bytes(), 250u);
+    BOOST_REQUIRE_EQUAL(instance.allocated_bytes(), 2000u);
+    BOOST_REQUIRE_EQUAL(instance.consumed_ratios().at(3), one);
+    BOOST_REQUIRE_EQUAL(instance.chunk_counts().at(1), one);
+    BOOST_REQUIRE_EQUAL(instance.multiple(99.0), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(block_telemetry__record__multiple_chunks__overflow)
+{
+    block_telemetry instance{};
+    instance.record(100, 2500, 3000, 2);
+    BOOST_REQUIRE_EQUAL(instance.blocks(), one);
+    BOOST_REQUIRE_EQUAL(instance.overflows(), one);
+    BOOST_REQUIRE_EQUAL(instance.chunk_counts().at(2), one);
+    BOOST_REQUIRE_EQUAL(instance.consumed_ratios().at(25), one);
+}
+
+BOOST_AUTO_TEST_CASE(block_telemetry__record__excessive__last_buckets)
+{
+    block_telemetry instance{};
+    instance.record(1, 1000, 1000, 1000);
+    BOOST_REQUIRE_EQUAL(instance.consumed_ratios().back(), one);
+    BOOST_REQUIRE_EQUAL(instance.chunk_counts().back(), one);
+}
+
+// multiple
+
+BOOST_AUTO_TEST_CASE(block_telemetry__multiple__percentiles__expected)
+{
+    block_telemetry instance{};
+    for (auto block = zero; block < 99u; ++block)
+        instance.record(100, 500, 2000, 1);
+
+    instance.record(100, 3000, 3000, 2);
+    BOOST_REQUIRE_EQUAL(instance.blocks(), 100u);
+    BOOST_REQUIRE_EQUAL(instance.multiple(50.0), 5u);
+    BOOST_REQUIRE_EQUAL(instance.multiple(99.0), 5u);
+    BOOST_REQUIRE_EQUAL(instance.multiple(100.0), 30u);
+}
+
+// block_arena
+
+BOOST_AUTO_TEST_CASE(block_telemetry__block_arena__detach__recorded)
+{
+    block_telemetry telemetry{};
+    block_arena instance{ 10, nullptr, false, &telemetry };
+
+    const auto memory = instance.start(100);
+    BOOST_REQUIRE_NE(instance.allocate(50, one), nullptr);
+    const auto consumed = instance.detach();
+    instance.release(memory);
+
+    BOOST_REQUIRE_EQUAL(telemetry.blocks(), one);
+    BOOST_REQUIRE_EQUAL(telemetry.overflows(), zero);
+    BOOST_REQUIRE_EQUAL(telemetry.wire_bytes(), 100u);
+    BOOST_REQUIRE_EQUAL(telemetry.consumed_bytes(), consumed);
+    BOOST_REQUIRE_EQUAL(telemetry.allocated_bytes(), 1000u);
+}
+
+BOOST_AUTO_TEST_CASE(block_telemetry__block_arena__overflow__recorded)
+{
+    block_telemetry telemetry{};
+    block_arena instance{ 1, nullptr, false, &telemetry };
+
+    const auto memory = instance.start(100);
+    BOOST_REQUIRE_NE(instance.allocate(500, one), nullptr);
+    instance.detach();
+    instance.release(memory);
+
+    BOOST_REQUIRE_EQUAL(telemetry.blocks(), one);
+    BOOST_REQUIRE_EQUAL(telemetry.overflows(), one);
+    BOOST_REQUIRE_EQUAL(telemetry.chunk_counts().at(2), one);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
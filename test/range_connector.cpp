@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(range_connector_tests)
+
+using namespace system;
+
+constexpr size_t range = 16;
+const code invalid_input{ system::error::missing_previous_output };
+const code invalid_other{ system::error::invalid_witness_commitment };
+
+BOOST_AUTO_TEST_CASE(range_connector__ranges__partial__ceilinged)
+{
+    const range_connector instance{ 1, 40, range, [](size_t) NOEXCEPT
+    {
+        return code{};
+    } };
+
+    BOOST_REQUIRE_EQUAL(instance.ranges(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(range_connector__wait__empty__success)
+{
+    range_connector instance{ 1, 1, range, [](size_t) NOEXCEPT
+    {
+        return code{};
+    } };
+
+    BOOST_REQUIRE_EQUAL(instance.ranges(), zero);
+    instance.run();
+    BOOST_REQUIRE(!instance.wait());
+}
+
+BOOST_AUTO_TEST_CASE(range_connector__run__valid__all_connected)
+{
+    std::atomic<size_t> connected{};
+    range_connector instance{ 1, 100, range, [&](size_t index) NOEXCEPT
+    {
+        BOOST_REQUIRE(!is_zero(index));
+        ++connected;
+        return code{};
+    } };
+
+    instance.run();
+    BOOST_REQUIRE(!instance.wait());
+    BOOST_REQUIRE_EQUAL(connected.load(), 99u);
+}
+
+BOOST_AUTO_TEST_CASE(range_connector__run__invalid_inputs__first_error_remaining_skipped)
+{
+    std::atomic_bool skipped{ true };
+    range_connector instance{ 1, 100, range, [&](size_t index) NOEXCEPT
+    {
+        if (index == 20)
+            return invalid_input;
+
+        if (index == 40)
+        {
+            skipped = false;
+            return invalid_other;
+        }
+
+        return code{};
+    } };
+
+    instance.run();
+    BOOST_REQUIRE_EQUAL(instance.wait(), invalid_input);
+    BOOST_REQUIRE(skipped.load());
+}
+
+BOOST_AUTO_TEST_CASE(range_connector__run__invalid_input_in_parallel_range__error)
+{
+    // The invalid input is in the fourth range, connected by any thread.
+    range_connector instance{ 1, 200, range, [](size_t index) NOEXCEPT
+    {
+        return index == 50 ? invalid_input : code{};
+    } };
+
+    std::vector<std::thread> helpers{};
+    for (auto helper = zero; helper < 3u; ++helper)
+        helpers.emplace_back([&]() NOEXCEPT { instance.run(); });
+
+    instance.run();
+    const auto ec = instance.wait();
+
+    for (auto& helper: helpers)
+        helper.join();
+
+    BOOST_REQUIRE_EQUAL(ec, invalid_input);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(rate_population_tests)
+
+using namespace system;
+
+constexpr auto tolerance = 0.000001;
+
+BOOST_AUTO_TEST_CASE(rate_population__construct__default__empty)
+{
+    const rate_population instance{};
+    BOOST_REQUIRE(instance.speeds().empty());
+    BOOST_REQUIRE(instance.latencies().empty());
+    BOOST_REQUIRE_EQUAL(instance.speed().count(), zero);
+    BOOST_REQUIRE_EQUAL(instance.latency().count(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(rate_population__set__zero_latency__speed_only)
+{
+    rate_population instance{};
+    instance.set(1, 100.0, 0.0);
+    BOOST_REQUIRE_EQUAL(instance.speeds().size(), one);
+    BOOST_REQUIRE(instance.latencies().empty());
+    BOOST_REQUIRE_CLOSE(instance.speed().mean(), 100.0, tolerance);
+    BOOST_REQUIRE_EQUAL(instance.latency().count(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(rate_population__set__replace__expected)
+{
+    rate_population instance{};
+    instance.set(1, 100.0, 10.0);
+    instance.set(2, 200.0, 20.0);
+    instance.set(1, 300.0, 30.0);
+    BOOST_REQUIRE_EQUAL(instance.speeds().size(), two);
+    BOOST_REQUIRE_EQUAL(instance.latencies().size(), two);
+    BOOST_REQUIRE_CLOSE(instance.speeds().at(1), 300.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.speed().mean(), 250.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.latency().mean(), 25.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(rate_population__set__zero_latency_replace__retains_latency)
+{
+    rate_population instance{};
+    instance.set(1, 100.0, 10.0);
+    instance.set(1, 200.0, 0.0);
+    BOOST_REQUIRE_CLOSE(instance.speeds().at(1), 200.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.latencies().at(1), 10.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(rate_population__erase__existing__removed)
+{
+    rate_population instance{};
+    instance.set(1, 100.0, 10.0);
+    instance.set(2, 200.0, 20.0);
+    instance.erase(1);
+    BOOST_REQUIRE_EQUAL(instance.speeds().size(), one);
+    BOOST_REQUIRE_EQUAL(instance.latencies().size(), one);
+    BOOST_REQUIRE_CLOSE(instance.speed().mean(), 200.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.latency().mean(), 20.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(rate_population__erase__missing__unchanged)
+{
+    rate_population instance{};
+    instance.set(1, 100.0, 10.0);
+    instance.erase(2);
+    BOOST_REQUIRE_EQUAL(instance.speeds().size(), one);
+    BOOST_REQUIRE_EQUAL(instance.speed().count(), one);
+}
+
+BOOST_AUTO_TEST_CASE(rate_population__ordered__set_replace_erase__ascending)
+{
+    rate_population instance{};
+    instance.set(1, 300.0, 10.0);
+    instance.set(2, 100.0, 20.0);
+    instance.set(3, 200.0, 30.0);
+    instance.set(2, 400.0, 0.0);
+    instance.erase(3);
+    BOOST_REQUIRE_EQUAL(instance.ordered().size(), two);
+    BOOST_REQUIRE_CLOSE(instance.ordered().front(), 300.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.ordered().back(), 400.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(rate_population__percentile__empty__zero)
+{
+    const rate_population instance{};
+    BOOST_REQUIRE_CLOSE(instance.percentile(10), 0.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(rate_population__percentile__populated__nearest_rank)
+{
+    rate_population instance{};
+    for (object_key channel = 1; channel <= 20; ++channel)
+        instance.set(channel, channel * 100.0, 0.0);
+
+    BOOST_REQUIRE_CLOSE(instance.percentile(0), 100.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.percentile(10), 300.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.percentile(50), 1100.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.percentile(100), 2000.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.percentile(200), 2000.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(rate_population__clear__populated__empty)
+{
+    rate_population instance{};
+    instance.set(1, 100.0, 10.0);
+    instance.set(2, 200.0, 20.0);
+    instance.clear();
+    BOOST_REQUIRE(instance.speeds().empty());
+    BOOST_REQUIRE(instance.ordered().empty());
+    BOOST_REQUIRE(instance.latencies().empty());
+    BOOST_REQUIRE_EQUAL(instance.speed().count(), zero);
+    BOOST_REQUIRE_EQUAL(instance.latency().count(), zero);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
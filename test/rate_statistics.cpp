@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(rate_statistics_tests)
+
+using namespace system;
+
+constexpr auto tolerance = 0.000001;
+
+BOOST_AUTO_TEST_CASE(rate_statistics__construct__default__zeros)
+{
+    const rate_statistics instance{};
+    BOOST_REQUIRE_EQUAL(instance.count(), zero);
+    BOOST_REQUIRE_EQUAL(instance.mean(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.total(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.variance(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.deviation(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(rate_statistics__add__one__no_variance)
+{
+    rate_statistics instance{};
+    instance.add(42.0);
+    BOOST_REQUIRE_EQUAL(instance.count(), one);
+    BOOST_REQUIRE_CLOSE(instance.mean(), 42.0, tolerance);
+    BOOST_REQUIRE_EQUAL(instance.variance(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(rate_statistics__add__multiple__expected)
+{
+    rate_statistics instance{};
+    instance.add(2.0);
+    instance.add(4.0);
+    instance.add(4.0);
+    instance.add(4.0);
+    instance.add(5.0);
+    instance.add(5.0);
+    instance.add(7.0);
+    instance.add(9.0);
+    BOOST_REQUIRE_EQUAL(instance.count(), 8u);
+    BOOST_REQUIRE_CLOSE(instance.mean(), 5.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.total(), 40.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.variance(), 32.0 / 7.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.deviation(), std::sqrt(32.0 / 7.0), tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(rate_statistics__remove__added__reverts)
+{
+    rate_statistics instance{};
+    instance.add(2.0);
+    instance.add(4.0);
+    instance.add(9.0);
+    instance.remove(9.0);
+    BOOST_REQUIRE_EQUAL(instance.count(), two);
+    BOOST_REQUIRE_CLOSE(instance.mean(), 3.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.variance(), 2.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(rate_statistics__remove__last__cleared)
+{
+    rate_statistics instance{};
+    instance.add(42.0);
+    instance.remove(42.0);
+    BOOST_REQUIRE_EQUAL(instance.count(), zero);
+    BOOST_REQUIRE_EQUAL(instance.mean(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.variance(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(rate_statistics__replace__added__expected)
+{
+    rate_statistics instance{};
+    instance.add(2.0);
+    instance.add(4.0);
+    instance.add(100.0);
+    instance.replace(100.0, 9.0);
+    BOOST_REQUIRE_EQUAL(instance.count(), 3u);
+    BOOST_REQUIRE_CLOSE(instance.mean(), 5.0, tolerance);
+    BOOST_REQUIRE_CLOSE(instance.variance(), 13.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(rate_statistics__clear__populated__zeros)
+{
+    rate_statistics instance{};
+    instance.add(2.0);
+    instance.add(4.0);
+    instance.clear();
+    BOOST_REQUIRE_EQUAL(instance.count(), zero);
+    BOOST_REQUIRE_EQUAL(instance.mean(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.variance(), 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
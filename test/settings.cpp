@@ -61,15 +61,30 @@ BOOST_AUTO_TEST_CASE(settings__node__default_context__expected)
     BOOST_REQUIRE_EQUAL(node.allowed_deviation, 1.5);
     BOOST_REQUIRE_EQUAL(node.announcement_cache, 42_u16);
     BOOST_REQUIRE_EQUAL(node.allocation_multiple, 20_u16);
+    BOOST_REQUIRE_EQUAL(node.allocation_mapping, false);
+    BOOST_REQUIRE_EQUAL(node.allocation_adaptive, false);
+    BOOST_REQUIRE_EQUAL(node.allocation_retention, 0_u64);
     ////BOOST_REQUIRE_EQUAL(node.snapshot_bytes, 200'000'000'000_u64);
     ////BOOST_REQUIRE_EQUAL(node.snapshot_valid, 250'000_u32);
     ////BOOST_REQUIRE_EQUAL(node.snapshot_confirm, 500'000_u32);
     BOOST_REQUIRE_EQUAL(node.maximum_height, 0_u32);
     BOOST_REQUIRE_EQUAL(node.maximum_height_(), max_size_t);
     BOOST_REQUIRE_EQUAL(node.maximum_concurrency, 50000_u32);
+    BOOST_REQUIRE_EQUAL(node.endgame_blocks, 0_u32);
+    BOOST_REQUIRE_EQUAL(node.download_batches, 1_u16);
+    BOOST_REQUIRE_EQUAL(node.download_batches_(), one);
+    BOOST_REQUIRE_EQUAL(node.slow_policy, "deviation");
+    BOOST_REQUIRE_EQUAL(node.slow_percentile, 10_u16);
     BOOST_REQUIRE_EQUAL(node.maximum_concurrency_(), 50000_size);
     BOOST_REQUIRE_EQUAL(node.sample_period_seconds, 10_u16);
     BOOST_REQUIRE_EQUAL(node.currency_window_minutes, 60_u32);
+    BOOST_REQUIRE_EQUAL(node.check_threads, 0_u32);
+    BOOST_REQUIRE_EQUAL(node.confirm_batch, 0_u32);
+    BOOST_REQUIRE_EQUAL(node.confirm_window, 0_u32);
+    BOOST_REQUIRE_EQUAL(node.prefetch_blocks, 0_u32);
+    BOOST_REQUIRE_EQUAL(node.populate_threads, 0_u32);
+    BOOST_REQUIRE_EQUAL(node.backlog_bytes, 0_u64);
+    BOOST_REQUIRE_EQUAL(node.tree_bytes, 268'435'456_u64);
     BOOST_REQUIRE_EQUAL(node.threads, 1_u32);
 
     BOOST_REQUIRE_EQUAL(node.threads_(), one);
@@ -79,6 +94,7 @@ BOOST_AUTO_TEST_CASE(settings__node__default_context__expected)
     BOOST_REQUIRE(node.currency_window() == steady_clock::duration(minutes(60)));
     BOOST_REQUIRE(node.thread_priority_() == network::processing_priority::high);
     BOOST_REQUIRE(node.memory_priority_() == network::memory_priority::highest);
+    BOOST_REQUIRE(node.slow_policy_() == eviction::deviation);
 }
 
 // [server]
@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(slow_policy_tests)
+
+using namespace system;
+
+constexpr auto tolerance = 0.000001;
+
+// Four typical channels and one slow channel (speed 10, latency 100).
+static rate_population population() NOEXCEPT
+{
+    rate_population out{};
+    out.set(1, 100.0, 10.0);
+    out.set(2, 100.0, 10.0);
+    out.set(3, 100.0, 10.0);
+    out.set(4, 100.0, 10.0);
+    out.set(5, 10.0, 100.0);
+    return out;
+}
+
+// Channel 5 is slow but responsive, channel 6 is fast but unresponsive.
+static slow_policy::trace trace() NOEXCEPT
+{
+    const slow_policy::trace round
+    {
+        { 1, 100, 10 },
+        { 2, 100, 10 },
+        { 3, 100, 10 },
+        { 4, 100, 10 },
+        { 6, 100, 100 },
+        { 5, 10, 10 }
+    };
+
+    slow_policy::trace out{ round };
+    out.insert(out.end(), round.begin(), round.end());
+    return out;
+}
+
+// create
+
+BOOST_AUTO_TEST_CASE(slow_policy__create__default__deviation)
+{
+    const node::settings settings{};
+    const auto policy = slow_policy::create(settings);
+    BOOST_REQUIRE(dynamic_cast<const deviation_policy*>(policy.get()) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(slow_policy__create__percentile__percentile)
+{
+    node::settings settings{};
+    settings.slow_policy = "percentile";
+    const auto policy = slow_policy::create(settings);
+    BOOST_REQUIRE(dynamic_cast<const percentile_policy*>(policy.get()) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(slow_policy__create__latency__latency)
+{
+    node::settings settings{};
+    settings.slow_policy = "latency";
+    const auto policy = slow_policy::create(settings);
+    BOOST_REQUIRE(dynamic_cast<const latency_policy*>(policy.get()) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(slow_policy__create__unrecognized__deviation)
+{
+    node::settings settings{};
+    settings.slow_policy = "bogus";
+    const auto policy = slow_policy::create(settings);
+    BOOST_REQUIRE(dynamic_cast<const deviation_policy*>(policy.get()) != nullptr);
+}
+
+// deviation_policy
+
+BOOST_AUTO_TEST_CASE(deviation_policy__is_slow__minimum_population__false)
+{
+    rate_population instance{};
+    instance.set(1, 100.0, 0.0);
+    instance.set(2, 100.0, 0.0);
+    instance.set(3, 1.0, 0.0);
+    const deviation_policy policy{ 1.5 };
+    BOOST_REQUIRE(!policy.is_slow(3, instance));
+}
+
+BOOST_AUTO_TEST_CASE(deviation_policy__is_slow__below_deviation__true)
+{
+    const deviation_policy policy{ 1.5 };
+    BOOST_REQUIRE(policy.is_slow(5, population()));
+}
+
+BOOST_AUTO_TEST_CASE(deviation_policy__is_slow__above_mean__false)
+{
+    const deviation_policy policy{ 1.5 };
+    BOOST_REQUIRE(!policy.is_slow(1, population()));
+}
+
+BOOST_AUTO_TEST_CASE(deviation_policy__is_slow__within_deviation__false)
+{
+    const deviation_policy policy{ 2.0 };
+    BOOST_REQUIRE(!policy.is_slow(5, population()));
+}
+
+BOOST_AUTO_TEST_CASE(deviation_policy__is_slow__missing__false)
+{
+    const deviation_policy policy{ 1.5 };
+    BOOST_REQUIRE(!policy.is_slow(42, population()));
+}
+
+// percentile_policy
+
+BOOST_AUTO_TEST_CASE(percentile_policy__is_slow__zero__false)
+{
+    const percentile_policy policy{ 0 };
+    BOOST_REQUIRE(!policy.is_slow(5, population()));
+}
+
+BOOST_AUTO_TEST_CASE(percentile_policy__is_slow__below_percentile__true)
+{
+    const percentile_policy policy{ 25 };
+    BOOST_REQUIRE(policy.is_slow(5, population()));
+}
+
+BOOST_AUTO_TEST_CASE(percentile_policy__is_slow__at_percentile__false)
+{
+    const percentile_policy policy{ 25 };
+    BOOST_REQUIRE(!policy.is_slow(1, population()));
+}
+
+BOOST_AUTO_TEST_CASE(percentile_policy__is_slow__excessive__fastest_false)
+{
+    rate_population instance{ population() };
+    instance.set(1, 200.0, 10.0);
+    const percentile_policy policy{ 1000 };
+    BOOST_REQUIRE(!policy.is_slow(1, instance));
+    BOOST_REQUIRE(policy.is_slow(2, instance));
+}
+
+// latency_policy
+
+BOOST_AUTO_TEST_CASE(latency_policy__is_slow__above_deviation__true)
+{
+    const latency_policy policy{ 1.5 };
+    BOOST_REQUIRE(policy.is_slow(5, population()));
+}
+
+BOOST_AUTO_TEST_CASE(latency_policy__is_slow__below_mean__false)
+{
+    const latency_policy policy{ 1.5 };
+    BOOST_REQUIRE(!policy.is_slow(1, population()));
+}
+
+BOOST_AUTO_TEST_CASE(latency_policy__is_slow__unmeasured__false)
+{
+    rate_population instance{ population() };
+    instance.set(6, 1.0, 0.0);
+    const latency_policy policy{ 1.5 };
+    BOOST_REQUIRE(!policy.is_slow(6, instance));
+}
+
+// replay
+
+BOOST_AUTO_TEST_CASE(slow_policy__replay__empty__zeros)
+{
+    const deviation_policy policy{ 1.5 };
+    const auto result = slow_policy::replay(policy, {});
+    BOOST_REQUIRE_EQUAL(result.samples, zero);
+    BOOST_REQUIRE_EQUAL(result.evictions, zero);
+    BOOST_REQUIRE_EQUAL(result.throughput, 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(slow_policy__replay__stalled__dropped)
+{
+    const deviation_policy policy{ 1.5 };
+    const slow_policy::trace trace
+    {
+        { 1, 100, 0 },
+        { 2, 0, 0 },
+        { 2, 100, 0 },
+        { 1, max_uint64, 0 },
+        { 1, 50, 0 }
+    };
+
+    const auto result = slow_policy::replay(policy, trace);
+    BOOST_REQUIRE_EQUAL(result.samples, 4u);
+    BOOST_REQUIRE_EQUAL(result.evictions, zero);
+    BOOST_REQUIRE_CLOSE(result.throughput, 150.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(slow_policy__replay__deviation__evicts_slow_speed)
+{
+    const deviation_policy policy{ 1.5 };
+    const auto result = slow_policy::replay(policy, trace());
+    BOOST_REQUIRE_EQUAL(result.samples, 12u);
+    BOOST_REQUIRE_EQUAL(result.evictions, one);
+    BOOST_REQUIRE_CLOSE(result.throughput, 1110.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(slow_policy__replay__percentile__evicts_slow_speed)
+{
+    const percentile_policy policy{ 25 };
+    const auto result = slow_policy::replay(policy, trace());
+    BOOST_REQUIRE_EQUAL(result.samples, 12u);
+    BOOST_REQUIRE_EQUAL(result.evictions, one);
+    BOOST_REQUIRE_CLOSE(result.throughput, 1110.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(slow_policy__replay__latency__evicts_high_latency)
+{
+    const latency_policy policy{ 1.5 };
+    const auto result = slow_policy::replay(policy, trace());
+    BOOST_REQUIRE_EQUAL(result.samples, 12u);
+    BOOST_REQUIRE_EQUAL(result.evictions, one);
+    BOOST_REQUIRE_CLOSE(result.throughput, 1020.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(slow_policy__replay__evicted__replaced_at_mean)
+{
+    const deviation_policy policy{ 1.5 };
+    const slow_policy::trace trace
+    {
+        { 1, 100, 0 },
+        { 2, 100, 0 },
+        { 3, 100, 0 },
+        { 4, 100, 0 },
+        { 5, 10, 0 },
+        { 5, 1000, 0 }
+    };
+
+    // The evicted slot reports the remaining population mean (100).
+    const auto result = slow_policy::replay(policy, trace);
+    BOOST_REQUIRE_EQUAL(result.samples, 6u);
+    BOOST_REQUIRE_EQUAL(result.evictions, one);
+    BOOST_REQUIRE_CLOSE(result.throughput, 510.0, tolerance);
+}
+
+BOOST_AUTO_TEST_CASE(slow_policy__replay__policies__compared)
+{
+    const auto throughput = [](const slow_policy& policy) NOEXCEPT
+    {
+        return slow_policy::replay(policy, trace()).throughput;
+    };
+
+    // Speed based eviction retains more throughput on this trace.
+    BOOST_REQUIRE_GT(throughput(deviation_policy{ 1.5 }),
+        throughput(latency_policy{ 1.5 }));
+    BOOST_REQUIRE_EQUAL(throughput(deviation_policy{ 1.5 }),
+        throughput(percentile_policy{ 25 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
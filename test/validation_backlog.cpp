@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(validation_backlog_tests)
+
+using bound = validation_backlog::bound;
+
+BOOST_AUTO_TEST_CASE(validation_backlog__construct__default__maximum)
+{
+    const validation_backlog instance{ 4, 100, 0 };
+    BOOST_REQUIRE_EQUAL(instance.limit(), 100_size);
+    BOOST_REQUIRE_EQUAL(instance.outstanding(), 0_u64);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__construct__maximum_below_threads__threads)
+{
+    const validation_backlog instance{ 4, 2, 0 };
+    BOOST_REQUIRE_EQUAL(instance.limit(), 4_size);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__construct__zero_threads__one)
+{
+    const validation_backlog instance{ 0, 0, 0 };
+    BOOST_REQUIRE_EQUAL(instance.limit(), one);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__started__completed__outstanding)
+{
+    validation_backlog instance{ 2, 100, 0 };
+    instance.started(10);
+    instance.started(20);
+    BOOST_REQUIRE_EQUAL(instance.outstanding(), 30_u64);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::none);
+    BOOST_REQUIRE_EQUAL(instance.outstanding(), 20_u64);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__partial_window__none)
+{
+    validation_backlog instance{ 3, 100, 0 };
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::none);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::none);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 100_size);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__stable_cost__cpu_bound_at_maximum)
+{
+    validation_backlog instance{ 1, 100, 0 };
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 100_size);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__rising_cost__store_bound_decreased)
+{
+    validation_backlog instance{ 1, 100, 0 };
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 200) == bound::store);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 75_size);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__restored_cost__cpu_bound_increased)
+{
+    validation_backlog instance{ 2, 100, 0 };
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::none);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 300) == bound::none);
+    BOOST_REQUIRE(instance.completed(10, 300) == bound::store);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 75_size);
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::none);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 77_size);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__store_bound__not_below_threads)
+{
+    validation_backlog instance{ 1, 2, 0 };
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 1000) == bound::store);
+    BOOST_REQUIRE_EQUAL(instance.limit(), one);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 10000) == bound::store);
+    BOOST_REQUIRE_EQUAL(instance.limit(), one);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__memory_exceeded__memory_bound_halved)
+{
+    validation_backlog instance{ 1, 100, 15 };
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::memory);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 50_size);
+    BOOST_REQUIRE_EQUAL(instance.outstanding(), 10_u64);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__memory_within__cpu_bound)
+{
+    validation_backlog instance{ 1, 100, 20 };
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 100_size);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__queue__dequeue__queued)
+{
+    validation_backlog instance{ 2, 100, 0 };
+    instance.queue();
+    instance.queue();
+    instance.dequeue();
+    BOOST_REQUIRE_EQUAL(instance.queued(), one);
+    instance.dequeue();
+    instance.dequeue();
+    BOOST_REQUIRE_EQUAL(instance.queued(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__zero_bytes__excluded)
+{
+    validation_backlog instance{ 1, 100, 0 };
+    BOOST_REQUIRE(instance.completed(0, 100) == bound::none);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__always_busy__cpu_bound_held)
+{
+    validation_backlog instance{ 2, 100, 0 };
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::none);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 300) == bound::none);
+    BOOST_REQUIRE(instance.completed(10, 300) == bound::store);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 75_size);
+    instance.queue();
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::none);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 75_size);
+}
+
+BOOST_AUTO_TEST_CASE(validation_backlog__completed__always_queued__cpu_bound_decreased)
+{
+    validation_backlog instance{ 2, 100, 0 };
+    instance.queue();
+    instance.queue();
+    instance.started(10);
+    instance.started(10);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::none);
+    BOOST_REQUIRE(instance.completed(10, 100) == bound::cpu);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 98_size);
+}
+
+BOOST_AUTO_TEST_SUITE_END()